@@ -0,0 +1,129 @@
+/**
+ * BatchDecoder.h
+ *
+ * Decodes many chromosomes in a single call. Besides decode(), a Decoder may implement
+ *     - void decodeBatch(BasicChromosome< Key >* chromosomes, unsigned n, double* fitness) const
+ *       (or the same with const BasicChromosome< Key >* chromosomes), which must set fitness[i] to
+ *       the fitness of chromosomes[i], for i = 0, ..., n - 1,
+ * in order to amortize fixed costs over a batch, vectorize across chromosomes, or hand the whole
+ * batch to an external evaluator. BRKGA then decodes each generation in MAX_THREADS batches (one
+ * per thread) instead of one chromosome at a time; chromosomes[] are views into the population,
+ * so no keys are copied. If Decoder has no decodeBatch(), BatchDecoder< Decoder, Key > falls back
+ * to calling decode() for each chromosome. The choice is made at compile time. Decoders that
+ * declare a Workspace (see Workspace.h) take a Workspace& as the last argument of decodeBatch().
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BATCHDECODER_H
+#define BATCHDECODER_H
+
+#include "Chromosome.h"
+#include "Workspace.h"
+
+/**
+ * HasDecodeBatch< Decoder, Key >::value is true iff Decoder declares either decodeBatch() above:
+ */
+template< class Decoder, class Key, bool workspace = HasWorkspace< Decoder >::value >
+class HasDecodeBatch {
+	template< class T, void (T::*)(BasicChromosome< Key >*, unsigned, double*) const >
+	struct Check { };
+
+	template< class T, void (T::*)(const BasicChromosome< Key >*, unsigned, double*) const >
+	struct CheckConst { };
+
+	template< class T >
+	static char test(Check< T, &T::decodeBatch >*);
+
+	template< class T >
+	static long test(...);
+
+	template< class T >
+	static char testConst(CheckConst< T, &T::decodeBatch >*);
+
+	template< class T >
+	static long testConst(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char) ||
+			sizeof(testConst< Decoder >(0)) == sizeof(char)) };
+};
+
+template< class Decoder, class Key >
+class HasDecodeBatch< Decoder, Key, true > {
+	typedef typename Decoder::Workspace Workspace;
+
+	template< class T,
+			void (T::*)(BasicChromosome< Key >*, unsigned, double*, Workspace&) const >
+	struct Check { };
+
+	template< class T,
+			void (T::*)(const BasicChromosome< Key >*, unsigned, double*, Workspace&) const >
+	struct CheckConst { };
+
+	template< class T >
+	static char test(Check< T, &T::decodeBatch >*);
+
+	template< class T >
+	static long test(...);
+
+	template< class T >
+	static char testConst(CheckConst< T, &T::decodeBatch >*);
+
+	template< class T >
+	static long testConst(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char) ||
+			sizeof(testConst< Decoder >(0)) == sizeof(char)) };
+};
+
+template< class Decoder, class Key, bool batch = HasDecodeBatch< Decoder, Key >::value >
+struct BatchDecoder {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+
+	static void decode(const Decoder& decoder, BasicChromosome< Key >* chromosomes, unsigned count,
+			double* fitness, Workspace& workspace) {
+		for(unsigned i = 0; i < count; ++i) {
+			fitness[i] = WorkspaceTraits< Decoder >::decode(decoder, chromosomes[i], workspace);
+		}
+	}
+};
+
+template< class Decoder, class Key >
+struct BatchDecoder< Decoder, Key, true > {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+
+	static void decode(const Decoder& decoder, BasicChromosome< Key >* chromosomes, unsigned count,
+			double* fitness, Workspace& workspace) {
+		WorkspaceTraits< Decoder >::decodeBatch(decoder, chromosomes, count, fitness, workspace);
+	}
+};
+
+#endif
@@ -0,0 +1,104 @@
+/**
+ * Cancellation.h
+ *
+ * A flag shared by the caller of BRKGA::evolve(), BRKGA and the decoder, with which an evolution
+ * can be abandoned midway (see BRKGA::setCancellationToken()). Any thread may call cancel() at
+ * any time, e.g. when the job that started the evolution is superseded; optionally, the token
+ * also cancels itself once a deadline passes. BRKGA checks the token before every generation and
+ * every decode (or batch), so it stops handing out decode work as soon as it is cancelled;
+ * decoders that run for long may hold a pointer to the same token and poll isCancelled(),
+ * returning any value once it is set, since BRKGA then discards what they return. Only evolve()
+ * is cut short: reset(), seedPopulation() and the other calls that decode outside of it always
+ * decode every chromosome they touch, so the populations are never left with stale fitness.
+ *
+ * isCancelled() only reads memory (and the clock, if a deadline is set), so polling it is cheap.
+ * reset() and cancelAfter() must not be called while the token is in use by BRKGA or a decoder.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CANCELLATION_H
+#define CANCELLATION_H
+
+#include <limits>
+
+#ifdef _OPENMP
+	#include <omp.h>
+#else
+	#include <sys/time.h>
+#endif
+
+class CancellationToken {
+public:
+	/*
+	 * Creates a token that is not cancelled and has no deadline:
+	 */
+	CancellationToken();
+
+	void cancel();						// Cancels the token; thread-safe
+	void cancelAfter(double seconds);	// Cancels it once 'seconds' of wall-clock time have passed
+	void reset();						// Clears the cancellation and the deadline
+	bool isCancelled() const;			// Has it been cancelled (or has its deadline passed)?
+
+private:
+	static double now();	// Wall-clock time in seconds, as BRKGA measures it
+
+	volatile int cancelled;
+	double deadline;		// now() at which the token cancels itself (infinity: never)
+};
+
+inline CancellationToken::CancellationToken() : cancelled(0),
+		deadline(std::numeric_limits< double >::infinity()) {
+}
+
+inline void CancellationToken::cancel() { cancelled = 1; }
+
+inline void CancellationToken::cancelAfter(double seconds) { deadline = now() + seconds; }
+
+inline void CancellationToken::reset() {
+	cancelled = 0;
+	deadline = std::numeric_limits< double >::infinity();
+}
+
+inline bool CancellationToken::isCancelled() const {
+	return cancelled != 0 ||
+			(deadline != std::numeric_limits< double >::infinity() && now() >= deadline);
+}
+
+inline double CancellationToken::now() {
+	#ifdef _OPENMP
+		return omp_get_wtime();
+	#else
+		timeval time;
+		gettimeofday(&time, 0);
+		return time.tv_sec + 1e-6 * time.tv_usec;
+	#endif
+}
+
+#endif
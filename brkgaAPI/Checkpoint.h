@@ -0,0 +1,215 @@
+/**
+ * Checkpoint.h
+ *
+ * Binary encoding of the checkpoints of BRKGA (see BRKGA::writeCheckpoint()). CheckpointWriter
+ * appends plain values to a buffer in the byte order of the machine, and writes the whole
+ * checkpoint to a stream with a single call once it is complete; CheckpointReader reads one back
+ * into a buffer and returns its values in the same order. A checkpoint consists of
+ *     - the magic bytes "BRKGA-CP" and the VERSION of the format,
+ *     - the platform: a byte order mark and the sizes of unsigned long and of the keys,
+ *     - the length of the payload and its 64-bit hash (see FitnessCache::hash()), and
+ *     - the payload, as written by BRKGA,
+ * and CheckpointReader throws std::runtime_error unless all of them match, so that checkpoints
+ * from another version of the format or another platform, or truncated or damaged ones, are
+ * rejected before anything is restored. It also throws if the payload runs out early.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <new>
+#include <string>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include "FitnessCache.h"
+
+class CheckpointWriter {
+public:
+	static const unsigned VERSION = 2;	// Version of the format written
+
+	CheckpointWriter();
+
+	template< class T >
+	void put(const T& value);							// A value of a plain type
+
+	template< class T >
+	void put(const T* values, std::size_t count);		// 'count' values of a plain type
+
+	void putString(const std::string& value);			// Its length, then its characters
+
+	// Writes the whole checkpoint to 'out' in one call, for keys of 'keySize' bytes:
+	void write(std::ostream& out, unsigned keySize) const throw(std::runtime_error);
+
+private:
+	std::string payload;
+};
+
+class CheckpointReader {
+public:
+	// Reads the checkpoint from 'in' and checks it, for keys of 'keySize' bytes:
+	CheckpointReader(std::istream& in, unsigned keySize) throw(std::runtime_error);
+
+	template< class T >
+	void get(T& value) throw(std::runtime_error);
+
+	template< class T >
+	void get(T* values, std::size_t count) throw(std::runtime_error);
+
+	std::string getString() throw(std::runtime_error);
+
+private:
+	static const std::size_t CHUNK = 1 << 20;	// Bytes of payload read at a time
+
+	std::string payload;
+	std::size_t position;	// Bytes of 'payload' read so far
+
+	void take(void* data, std::size_t bytes) throw(std::runtime_error);	// Next 'bytes' bytes
+};
+
+// The header, in the order written:
+struct CheckpointHeader {
+	char magic[8];
+	unsigned int version;
+	unsigned int byteOrder;			// 0x01020304 as written by the machine
+	unsigned int longSize;			// sizeof(unsigned long)
+	unsigned int keySize;			// sizeof(Key)
+	unsigned long length;			// Bytes in the payload
+	FitnessCache::Hash checksum;	// Hash of the payload
+};
+
+inline CheckpointWriter::CheckpointWriter() : payload() { }
+
+template< class T >
+inline void CheckpointWriter::put(const T& value) {
+	payload.append(reinterpret_cast< const char* >(&value), sizeof(T));
+}
+
+template< class T >
+inline void CheckpointWriter::put(const T* values, std::size_t count) {
+	payload.append(reinterpret_cast< const char* >(values), count * sizeof(T));
+}
+
+inline void CheckpointWriter::putString(const std::string& value) {
+	put((unsigned long) value.size());
+	payload.append(value);
+}
+
+inline void CheckpointWriter::write(std::ostream& out, unsigned keySize) const
+		throw(std::runtime_error) {
+	CheckpointHeader header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, "BRKGA-CP", sizeof(header.magic));
+	header.version = VERSION;
+	header.byteOrder = 0x01020304U;
+	header.longSize = sizeof(unsigned long);
+	header.keySize = keySize;
+	header.length = payload.size();
+	header.checksum = FitnessCache::hash(payload.data(), payload.size());
+
+	std::string checkpoint;
+	checkpoint.reserve(sizeof(header) + payload.size());
+	checkpoint.append(reinterpret_cast< const char* >(&header), sizeof(header));
+	checkpoint.append(payload);
+	if(!out.write(checkpoint.data(), std::streamsize(checkpoint.size()))) {
+		throw std::runtime_error("Cannot write checkpoint.");
+	}
+}
+
+inline CheckpointReader::CheckpointReader(std::istream& in, unsigned keySize)
+		throw(std::runtime_error) : payload(), position(0) {
+	CheckpointHeader header;
+	if(!in.read(reinterpret_cast< char* >(&header), sizeof(header)) ||
+			std::memcmp(header.magic, "BRKGA-CP", sizeof(header.magic)) != 0) {
+		throw std::runtime_error("Not a checkpoint.");
+	}
+
+	if(header.version != CheckpointWriter::VERSION) {
+		throw std::runtime_error("Checkpoint written by another version.");
+	}
+
+	if(header.byteOrder != 0x01020304U || header.longSize != sizeof(unsigned long)) {
+		throw std::runtime_error("Checkpoint written by another type of machine.");
+	}
+
+	if(header.keySize != keySize) { throw std::runtime_error("Checkpoint of another key type."); }
+
+	// The length is not covered by the checksum, so a damaged one must not size the buffer:
+	// read the payload in chunks, growing it only by what the stream actually holds.
+	try {
+		while(payload.size() < header.length) {
+			const std::size_t offset = payload.size();
+			const std::size_t left = std::size_t(header.length - offset);
+			const std::size_t chunk = (left < CHUNK ? left : CHUNK);
+			payload.resize(offset + chunk);
+			if(!in.read(&payload[offset], std::streamsize(chunk))) {
+				throw std::runtime_error("Truncated checkpoint.");
+			}
+		}
+	} catch(const std::bad_alloc&) {
+		throw std::runtime_error("Checkpoint too large.");
+	} catch(const std::length_error&) {
+		throw std::runtime_error("Checkpoint too large.");
+	}
+
+	if(FitnessCache::hash(payload.data(), payload.size()) != header.checksum) {
+		throw std::runtime_error("Damaged checkpoint.");
+	}
+}
+
+template< class T >
+inline void CheckpointReader::get(T& value) throw(std::runtime_error) {
+	take(&value, sizeof(T));
+}
+
+template< class T >
+inline void CheckpointReader::get(T* values, std::size_t count) throw(std::runtime_error) {
+	take(values, count * sizeof(T));
+}
+
+inline std::string CheckpointReader::getString() throw(std::runtime_error) {
+	unsigned long size;
+	get(size);
+	if(payload.size() - position < size) { throw std::runtime_error("Incomplete checkpoint."); }
+
+	std::string value(size, '\0');
+	if(size > 0) { take(&value[0], size); }
+	return value;
+}
+
+inline void CheckpointReader::take(void* data, std::size_t bytes) throw(std::runtime_error) {
+	if(payload.size() - position < bytes) { throw std::runtime_error("Incomplete checkpoint."); }
+	std::memcpy(data, payload.data() + position, bytes);
+	position += bytes;
+}
+
+#endif
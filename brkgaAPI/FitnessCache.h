@@ -0,0 +1,316 @@
+/**
+ * FitnessCache.h
+ *
+ * A bounded, thread-safe cache from chromosomes to fitness values, used by BRKGA to skip decoding
+ * chromosomes that were decoded before (see BRKGA::setFitnessCache()). Chromosomes are identified
+ * by a 64-bit hash of their raw keys, made of two 32-bit MurmurHash3 lanes with different seeds;
+ * their keys are not stored. The lanes mix the same words, so they are not independent: two
+ * different chromosomes are confused with probability at most that of one lane, about 2^-32 per
+ * pair, and usually far less, but not with the 2^-64 of an ideal 64-bit hash.
+ *
+ * The cache is 4-way set associative: a hash can only live in one of 'capacity' / 4 sets, and
+ * inserting into a full set evicts its least recently used entry. Each set has its own spinlock,
+ * so threads only contend when they touch the same set. The numbers of hits, misses, insertions
+ * and evictions are counted.
+ *
+ * An entry may also hold a lower bound on the fitness instead of the fitness itself, as returned
+ * by decoders that stop early (see BoundedDecoder.h); such an entry is only found by lookups with
+ * a cutoff below the bound, which would reject the chromosome just the same.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef FITNESSCACHE_H
+#define FITNESSCACHE_H
+
+#include <limits>
+#include <vector>
+#include <cstring>
+
+class FitnessCache {
+public:
+	static const unsigned WAYS = 4;	// Entries per set
+
+	/**
+	 * Identifies a chromosome:
+	 */
+	struct Hash {
+		unsigned int h1, h2;
+
+		bool operator==(const Hash& other) const { return h1 == other.h1 && h2 == other.h2; }
+		bool operator!=(const Hash& other) const { return !(*this == other); }
+	};
+
+	/*
+	 * Creates an empty cache holding up to 'capacity' entries (rounded up to a multiple of WAYS):
+	 */
+	explicit FitnessCache(unsigned capacity);
+
+	// Hashes the raw bytes of keys[0], ..., keys[n - 1]:
+	template< class Key >
+	static Hash hash(const Key* keys, std::size_t n);
+
+	// Sets 'fitness' and returns true if 'hash' is cached with its fitness, or with a lower bound
+	// greater than 'cutoff'; returns false otherwise:
+	bool find(const Hash& hash, double& fitness,
+			double cutoff = std::numeric_limits< double >::infinity());
+
+	// Caches 'fitness' for 'hash' (as a lower bound if 'bound' is set, which never replaces the
+	// fitness itself), evicting the least recently used entry of its set if needed:
+	void insert(const Hash& hash, double fitness, bool bound = false);
+
+	void clear();	// Removes all entries (the counters are kept)
+
+	// Writes the entries and counters to a CheckpointWriter, or reads them back from a
+	// CheckpointReader into a cache of the same capacity (see Checkpoint.h):
+	template< class Writer >
+	void write(Writer& out) const;
+
+	template< class Reader >
+	void read(Reader& in);
+
+	unsigned getCapacity() const;			// Maximum number of entries
+	unsigned long getHits() const;			// Calls to find() that returned true
+	unsigned long getMisses() const;		// Calls to find() that returned false
+	unsigned long getInsertions() const;	// Calls to insert() that added a new entry
+	unsigned long getEvictions() const;		// Entries evicted to make room for new ones
+
+private:
+	struct Entry {
+		Hash hash;
+		double fitness;
+		bool bound;				// Is 'fitness' a lower bound only?
+		unsigned long stamp;	// Time of the last use (0: empty entry)
+	};
+
+	struct Set {
+		volatile int lock;		// Spinlock protecting 'entries'
+		Entry entries[WAYS];
+	};
+
+	static unsigned int rotl(unsigned int x, int r);
+	static unsigned int mix(unsigned int h, unsigned int word);		// One MurmurHash3 round
+	static unsigned int finalize(unsigned int h, unsigned int length);	// MurmurHash3 finalizer
+
+	Set& getSet(const Hash& hash);
+	static void lock(Set& set);
+	static void unlock(Set& set);
+
+	std::vector< Set > sets;
+	unsigned long clock;		// Incremented on every use of an entry (atomically)
+	unsigned long hits, misses, insertions, evictions;	// Counters (updated atomically)
+};
+
+inline FitnessCache::FitnessCache(unsigned capacity) :
+		sets((capacity + WAYS - 1) / WAYS > 0 ? (capacity + WAYS - 1) / WAYS : 1),
+		clock(0), hits(0), misses(0), insertions(0), evictions(0) {
+	clear();
+}
+
+template< class Key >
+inline FitnessCache::Hash FitnessCache::hash(const Key* keys, std::size_t n) {
+	const unsigned char* bytes = reinterpret_cast< const unsigned char* >(keys);
+	const std::size_t length = n * sizeof(Key);
+
+	Hash h;
+	h.h1 = 0x243f6a88U;
+	h.h2 = 0x85a308d3U;
+
+	std::size_t i = 0;
+	for( ; i + 4 <= length; i += 4) {
+		unsigned int word;
+		std::memcpy(&word, bytes + i, 4);
+		h.h1 = mix(h.h1, word);
+		h.h2 = mix(h.h2, word ^ 0x9e3779b9U);
+	}
+
+	if(i < length) {
+		unsigned int word = 0;
+		std::memcpy(&word, bytes + i, length - i);
+		h.h1 = mix(h.h1, word);
+		h.h2 = mix(h.h2, word ^ 0x9e3779b9U);
+	}
+
+	// Fold the length into 32 bits (a no-op below 4 GiB; shifted twice in case size_t has 32):
+	const unsigned int folded = unsigned(length) ^ unsigned((length >> 16) >> 16);
+	h.h1 = finalize(h.h1, folded);
+	h.h2 = finalize(h.h2, folded);
+	return h;
+}
+
+inline bool FitnessCache::find(const Hash& hash, double& fitness, double cutoff) {
+	Set& set = getSet(hash);
+	lock(set);
+	for(unsigned w = 0; w < WAYS; ++w) {
+		Entry& entry = set.entries[w];
+		if(entry.stamp != 0 && entry.hash == hash && (!entry.bound || entry.fitness > cutoff)) {
+			fitness = entry.fitness;
+			entry.stamp = __sync_add_and_fetch(&clock, 1UL);
+			unlock(set);
+
+			__sync_fetch_and_add(&hits, 1UL);
+			return true;
+		}
+	}
+
+	unlock(set);
+	__sync_fetch_and_add(&misses, 1UL);
+	return false;
+}
+
+inline void FitnessCache::insert(const Hash& hash, double fitness, bool bound) {
+	Set& set = getSet(hash);
+	lock(set);
+
+	// Refresh the entry of 'hash' if there is one; otherwise take the least recently used one:
+	unsigned victim = 0;
+	for(unsigned w = 0; w < WAYS; ++w) {
+		const Entry& entry = set.entries[w];
+		if(entry.stamp != 0 && entry.hash == hash) { victim = w; break; }
+		if(entry.stamp < set.entries[victim].stamp) { victim = w; }
+	}
+
+	Entry& entry = set.entries[victim];
+	const bool added = (entry.stamp == 0 || entry.hash != hash);
+	const bool evicted = (entry.stamp != 0 && entry.hash != hash);
+	if(added || entry.bound || !bound) {
+		entry.hash = hash;
+		entry.fitness = fitness;
+		entry.bound = bound;
+	}
+
+	entry.stamp = __sync_add_and_fetch(&clock, 1UL);
+	unlock(set);
+
+	if(added) { __sync_fetch_and_add(&insertions, 1UL); }
+	if(evicted) { __sync_fetch_and_add(&evictions, 1UL); }
+}
+
+inline void FitnessCache::clear() {
+	for(unsigned s = 0; s < sets.size(); ++s) {
+		sets[s].lock = 0;
+		for(unsigned w = 0; w < WAYS; ++w) {
+			sets[s].entries[w].hash.h1 = 0;
+			sets[s].entries[w].hash.h2 = 0;
+			sets[s].entries[w].fitness = 0.0;
+			sets[s].entries[w].bound = false;
+			sets[s].entries[w].stamp = 0;
+		}
+	}
+}
+
+template< class Writer >
+inline void FitnessCache::write(Writer& out) const {
+	for(unsigned s = 0; s < sets.size(); ++s) {
+		for(unsigned w = 0; w < WAYS; ++w) {
+			const Entry& entry = sets[s].entries[w];
+			out.put(entry.hash.h1);
+			out.put(entry.hash.h2);
+			out.put(entry.fitness);
+			out.put(char(entry.bound));
+			out.put(entry.stamp);
+		}
+	}
+
+	out.put(clock);
+	out.put(hits);
+	out.put(misses);
+	out.put(insertions);
+	out.put(evictions);
+}
+
+template< class Reader >
+inline void FitnessCache::read(Reader& in) {
+	for(unsigned s = 0; s < sets.size(); ++s) {
+		sets[s].lock = 0;
+		for(unsigned w = 0; w < WAYS; ++w) {
+			Entry& entry = sets[s].entries[w];
+			char bound;
+			in.get(entry.hash.h1);
+			in.get(entry.hash.h2);
+			in.get(entry.fitness);
+			in.get(bound);
+			in.get(entry.stamp);
+			entry.bound = (bound != 0);
+		}
+	}
+
+	in.get(clock);
+	in.get(hits);
+	in.get(misses);
+	in.get(insertions);
+	in.get(evictions);
+}
+
+inline unsigned FitnessCache::getCapacity() const { return unsigned(sets.size() * WAYS); }
+
+inline unsigned long FitnessCache::getHits() const { return hits; }
+
+inline unsigned long FitnessCache::getMisses() const { return misses; }
+
+inline unsigned long FitnessCache::getInsertions() const { return insertions; }
+
+inline unsigned long FitnessCache::getEvictions() const { return evictions; }
+
+inline unsigned int FitnessCache::rotl(unsigned int x, int r) {
+	return ((x << r) | (x >> (32 - r))) & 0xffffffffU;
+}
+
+inline unsigned int FitnessCache::mix(unsigned int h, unsigned int word) {
+	word = (word * 0xcc9e2d51U) & 0xffffffffU;
+	word = (rotl(word, 15) * 0x1b873593U) & 0xffffffffU;
+	h = rotl(h ^ word, 13);
+	return (h * 5U + 0xe6546b64U) & 0xffffffffU;
+}
+
+inline unsigned int FitnessCache::finalize(unsigned int h, unsigned int length) {
+	h ^= length;
+	h ^= h >> 16;
+	h = (h * 0x85ebca6bU) & 0xffffffffU;
+	h ^= h >> 13;
+	h = (h * 0xc2b2ae35U) & 0xffffffffU;
+	h ^= h >> 16;
+	return h;
+}
+
+inline FitnessCache::Set& FitnessCache::getSet(const Hash& hash) {
+	return sets[hash.h1 % sets.size()];
+}
+
+inline void FitnessCache::lock(Set& set) {
+	while(__sync_lock_test_and_set(&set.lock, 1)) {
+		while(set.lock) { }
+	}
+}
+
+inline void FitnessCache::unlock(Set& set) {
+	__sync_lock_release(&set.lock);
+}
+
+#endif
@@ -0,0 +1,149 @@
+/**
+ * Incumbent.h
+ *
+ * The best chromosome found so far by BRKGA and its fitness, published so that any thread may read
+ * them at any time without slowing down the threads that evolve the populations (see
+ * BRKGA::getIncumbent()). It is protected by a sequence lock: a writer makes the sequence number
+ * odd, copies the chromosome in and makes it even again, and a reader copies the chromosome out and
+ * retries if the sequence number was odd or changed meanwhile. Readers never write to shared
+ * memory, so they cannot delay the writers; writers only wait for each other (on a spinlock),
+ * which happens when islands evolved in parallel improve at the same time.
+ *
+ * offer() publishes a chromosome if it is better than the incumbent, which BRKGA calls at the end
+ * of every generation of each population; the keys are copied by the writer, so a reader may
+ * retry at most as many times as chromosomes are published while it copies one.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef INCUMBENT_H
+#define INCUMBENT_H
+
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+template< class Key >
+class Incumbent {
+public:
+	/*
+	 * Creates an empty incumbent for chromosomes of n keys, with infinite fitness:
+	 */
+	explicit Incumbent(unsigned n);
+
+	// Publishes keys[0], ..., keys[n - 1] with 'fitness' if it is lower than that of the incumbent,
+	// and returns whether it did:
+	bool offer(double fitness, const Key* keys);
+
+	// Copies the incumbent into keys[0], ..., keys[n - 1] and returns its fitness (infinity, and
+	// keys left unspecified, if none was published yet); thread-safe and lock-free:
+	double read(Key* keys) const;
+
+	double getFitness() const;			// Fitness of the incumbent; thread-safe and lock-free
+	unsigned long getVersion() const;	// Number of chromosomes published so far
+
+	void clear();	// Forgets the incumbent; must not run concurrently with the other methods
+
+private:
+	void lock();
+	void unlock();
+
+	volatile unsigned long sequence;	// Twice the version, plus one while a writer is copying
+	volatile int flag;					// Spinlock serializing the writers
+	double fitness;
+	std::vector< Key > keys;
+};
+
+template< class Key >
+inline Incumbent< Key >::Incumbent(unsigned n) : sequence(0), flag(0),
+		fitness(std::numeric_limits< double >::infinity()), keys(n) {
+}
+
+template< class Key >
+inline bool Incumbent< Key >::offer(double _fitness, const Key* _keys) {
+	// Cheap test first (a stale value only costs a lock below):
+	if(!(_fitness < getFitness())) { return false; }
+
+	lock();
+	const bool better = (_fitness < fitness);
+	if(better) {
+		++sequence;
+		__sync_synchronize();
+		fitness = _fitness;
+		std::copy(_keys, _keys + keys.size(), keys.begin());
+		__sync_synchronize();
+		++sequence;
+	}
+	unlock();
+
+	return better;
+}
+
+template< class Key >
+inline double Incumbent< Key >::read(Key* _keys) const {
+	for( ; ; ) {
+		const unsigned long before = sequence;
+		__sync_synchronize();
+		if(before & 1UL) { continue; }	// A writer is copying
+
+		const double value = fitness;
+		std::copy(keys.begin(), keys.end(), _keys);
+		__sync_synchronize();
+		if(sequence == before) { return value; }
+	}
+}
+
+template< class Key >
+inline double Incumbent< Key >::getFitness() const {
+	for( ; ; ) {
+		const unsigned long before = sequence;
+		__sync_synchronize();
+		if(before & 1UL) { continue; }
+
+		const double value = fitness;
+		__sync_synchronize();
+		if(sequence == before) { return value; }
+	}
+}
+
+template< class Key >
+inline unsigned long Incumbent< Key >::getVersion() const { return sequence / 2; }
+
+template< class Key >
+inline void Incumbent< Key >::clear() { fitness = std::numeric_limits< double >::infinity(); }
+
+template< class Key >
+inline void Incumbent< Key >::lock() {
+	while(__sync_lock_test_and_set(&flag, 1)) { while(flag) { } }
+}
+
+template< class Key >
+inline void Incumbent< Key >::unlock() { __sync_lock_release(&flag); }
+
+#endif
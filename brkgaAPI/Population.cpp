@@ -39,68 +39,140 @@
 
 #include "Population.h"
 
-Population::Population(const Population& pop) :
-		population(pop.population),
-		fitness(pop.fitness) {
+template< class Key >
+BasicPopulation< Key >::BasicPopulation(const BasicPopulation& pop) :
+		n(pop.n), p(pop.p), stride(pop.stride), storage(0), keys(0), population(),
+		fitness(pop.fitness), sorted(pop.sorted), cost(pop.cost) {
+	allocate();
+	for(unsigned i = 0; i < p; ++i) {
+		std::copy(pop.population[i].begin(), pop.population[i].end(), population[i].begin());
+	}
 }
 
-Population::Population(const unsigned n, const unsigned p) :
-		population(p, std::vector< double >(n, 0.0)), fitness(p) {
+template< class Key >
+BasicPopulation< Key >::BasicPopulation(const unsigned _n, const unsigned _p) :
+		n(_n), p(_p),
+		stride(((_n + ALIGNMENT / sizeof(Key) - 1) / (ALIGNMENT / sizeof(Key)))
+				* (ALIGNMENT / sizeof(Key))),
+		storage(0), keys(0), population(), fitness(_p), sorted(0), cost(_p, 0.0) {
 	if(p == 0) { throw std::range_error("Population size p cannot be zero."); }
 	if(n == 0) { throw std::range_error("Chromosome size n cannot be zero."); }
+
+	allocate();
+	std::fill(keys, keys + std::size_t(p) * stride, Key(0));
+}
+
+template< class Key >
+BasicPopulation< Key >::~BasicPopulation() {
+	delete[] storage;
 }
 
-Population::~Population() {
+template< class Key >
+void BasicPopulation< Key >::allocate() {
+	// Over-allocate by one alignment unit so that the first row can start at an aligned address:
+	const std::size_t padding = ALIGNMENT / sizeof(Key);
+	storage = new Key[std::size_t(p) * stride + padding];
+
+	const std::size_t misalignment = reinterpret_cast< std::size_t >(storage) % ALIGNMENT;
+	keys = storage + (misalignment == 0 ? 0 : (ALIGNMENT - misalignment) / sizeof(Key));
+
+	population.resize(p);
+	for(unsigned i = 0; i < p; ++i) {
+		population[i] = BasicChromosome< Key >(keys + std::size_t(i) * stride, n);
+	}
 }
 
-unsigned Population::getN() const {
-	return population[0].size();
+template< class Key >
+unsigned BasicPopulation< Key >::getN() const {
+	return n;
 }
 
-unsigned Population::getP() const {
-	return population.size();
+template< class Key >
+unsigned BasicPopulation< Key >::getP() const {
+	return p;
 }
 
-double Population::getBestFitness() const {
+template< class Key >
+double BasicPopulation< Key >::getBestFitness() const {
 	return getFitness(0);
 }
 
-double Population::getFitness(unsigned i) const {
+template< class Key >
+double BasicPopulation< Key >::getFitness(unsigned i) const {
 	#ifdef RANGECHECK
 		if(i >= getP()) { throw std::range_error("Invalid individual identifier."); }
 	#endif
+	if(i >= sorted) { completeSort(); }
 	return fitness[i].first;
 }
 
-const std::vector< double >& Population::getChromosome(unsigned i) const {
+template< class Key >
+const BasicChromosome< Key >& BasicPopulation< Key >::getChromosome(unsigned i) const {
 	#ifdef RANGECHECK
 		if(i >= getP()) { throw std::range_error("Invalid individual identifier."); }
 	#endif
-	
+	if(i >= sorted) { completeSort(); }
+
 	return population[ fitness[i].second ];
 }
 
-std::vector< double >& Population::getChromosome(unsigned i) {
+template< class Key >
+BasicChromosome< Key >& BasicPopulation< Key >::getChromosome(unsigned i) {
 	#ifdef RANGECHECK
 		if(i >= getP()) { throw std::range_error("Invalid individual identifier."); }
 	#endif
-	
+	if(i >= sorted) { completeSort(); }
+
 	return population[ fitness[i].second ];
 }
 
-void Population::setFitness(unsigned i, double f) {
+template< class Key >
+void BasicPopulation< Key >::setFitness(unsigned i, double f) {
 	fitness[i].first = f;
 	fitness[i].second = i;
 }
 
-void Population::sortFitness() {
+template< class Key >
+void BasicPopulation< Key >::sortFitness() {
 	sort(fitness.begin(), fitness.end());
+	sorted = p;
+}
+
+template< class Key >
+void BasicPopulation< Key >::sortFitness(unsigned top) {
+	if(top >= p) { sortFitness(); return; }
+
+	// Move the 'top' best entries to the front, then sort just these:
+	std::nth_element(fitness.begin(), fitness.begin() + top, fitness.end());
+	std::sort(fitness.begin(), fitness.begin() + top);
+	sorted = top;
+}
+
+template< class Key >
+void BasicPopulation< Key >::completeSort() const {
+	// Entries past 'sorted' are no better than those before it, so sorting them suffices:
+	std::sort(fitness.begin() + sorted, fitness.end());
+	sorted = p;
 }
 
-double& Population::operator()(unsigned chromosome, unsigned allele) {
-	return population[chromosome][allele];
+template< class Key >
+Key& BasicPopulation< Key >::operator()(unsigned chromosome, unsigned allele) {
+	return population[chromosome].data()[allele];
 }
 
-std::vector< double >& Population::operator()(unsigned chromosome) {
+template< class Key >
+BasicChromosome< Key >& BasicPopulation< Key >::operator()(unsigned chromosome) {
 	return population[chromosome];
-}
\ No newline at end of file
+}
+
+template< class Key >
+void BasicPopulation< Key >::swapRows(unsigned i, BasicPopulation& other, unsigned j) {
+	std::swap(population[i], other.population[j]);
+	std::swap(cost[i], other.cost[j]);
+}
+
+// Key types supported by BRKGA (see KeyTraits.h):
+template class BasicPopulation< double >;
+template class BasicPopulation< float >;
+template class BasicPopulation< unsigned int >;
+template class BasicPopulation< unsigned short >;
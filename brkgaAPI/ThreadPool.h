@@ -0,0 +1,267 @@
+/**
+ * ThreadPool.h
+ *
+ * A persistent team of worker threads that BRKGA reuses across generations and islands instead of
+ * opening a new OpenMP parallel region for every loop (see BRKGA::setThreadPool()). The workers
+ * are created once and sleep between loops; run(task, count) wakes them up, and the workers and
+ * the calling thread then claim indices 0, ..., count - 1 one chunk at a time (so faster threads
+ * simply take more of them) and call task(i, thread) for each one, where thread = 0 for the caller
+ * and w for worker w. run() returns once every index is done.
+ *
+ * Threads poll for a short while before sleeping, which keeps short loops cheap, unless the pool
+ * has more threads than there are online CPUs. Optionally, worker w (w = 1, ..., threads - 1) is
+ * pinned to CPU (firstCPU + w) modulo the number of online CPUs; the calling thread is left alone.
+ * Pinning is only available on Linux.
+ *
+ * A ThreadPool of 'threads' threads owns threads - 1 workers, since the caller also works. The
+ * workers are POSIX threads, which are only created when compiling with OpenMP (-fopenmp), the
+ * switch used for multithreading throughout the API; otherwise run() calls task(i) serially.
+ * Tasks run by a ThreadPool must not throw.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+
+#ifdef _OPENMP
+	#include <pthread.h>
+	#include <unistd.h>
+	#ifdef __linux__
+		#include <sched.h>
+	#endif
+#endif
+
+class ThreadPool {
+public:
+	/*
+	 * Creates threads - 1 workers (threads = 0 behaves as threads = 1); see above for 'pinned'.
+	 */
+	explicit ThreadPool(unsigned threads, bool pinned = false, unsigned firstCPU = 0);
+
+	/*
+	 * Stops and joins the workers; must not be called while run() is executing.
+	 */
+	~ThreadPool();
+
+	/*
+	 * Calls task(i, thread) for i = 0, ..., count - 1 on all threads, and returns when all calls
+	 * are done. Task is any class with a member void operator()(unsigned i, unsigned thread) const,
+	 * where 0 <= thread < getThreads() identifies the calling thread. Threads claim 'chunk'
+	 * consecutive indices at a time. Only one thread may call run() at a time.
+	 */
+	template< class Task >
+	void run(const Task& task, unsigned count, unsigned chunk = 1);
+
+	unsigned getThreads() const;	// Number of threads, including the caller of run()
+	bool getPinned() const;			// Are the workers pinned to CPUs?
+
+private:
+	typedef void (*Job)(const void* task, unsigned i, unsigned thread);
+
+	template< class Task >
+	static void invoke(const void* task, unsigned i, unsigned thread);	// Calls task(i, thread)
+
+	void execute(unsigned thread);		// Claims and runs indices until none is left
+
+	const unsigned threads;
+	const bool pinned;
+
+	// The current loop:
+	Job job;
+	const void* task;
+	unsigned count;
+	unsigned chunk;		// Indices claimed at a time
+	unsigned next;		// Next index to claim (atomically)
+
+	#ifdef _OPENMP
+		struct Worker {
+			ThreadPool* pool;
+			unsigned thread;		// 1, ..., threads - 1
+			pthread_t handle;
+		};
+
+		static void* work(void* worker);	// Entry point of the workers
+
+		static const unsigned SPIN = 4096;	// Polls of 'round' or 'pending' before sleeping
+
+		unsigned spin;			// SPIN, or 0 if the threads outnumber the online CPUs
+		unsigned long round;	// Number of loops started so far
+		unsigned pending;		// Workers that have not finished the current loop yet
+		bool stopping;			// Set by the destructor
+
+		pthread_mutex_t mutex;
+		pthread_cond_t start;	// Signaled when a loop starts (or the pool stops)
+		pthread_cond_t done;	// Signaled when the last worker finishes a loop
+		std::vector< Worker > workers;	// Never reallocated, since the workers point into it
+	#endif
+
+	ThreadPool(const ThreadPool&);				// Not allowed
+	ThreadPool& operator=(const ThreadPool&);	// Not allowed
+};
+
+inline ThreadPool::ThreadPool(unsigned _threads, bool _pinned, unsigned firstCPU) :
+		threads(_threads > 0 ? _threads : 1), pinned(_pinned), job(0), task(0), count(0), chunk(1),
+		next(0)
+		#ifdef _OPENMP
+			, spin(0), round(0), pending(0), stopping(false), mutex(), start(), done(), workers()
+		#endif
+		{
+	#ifdef _OPENMP
+		pthread_mutex_init(&mutex, 0);
+		pthread_cond_init(&start, 0);
+		pthread_cond_init(&done, 0);
+
+		const long online = sysconf(_SC_NPROCESSORS_ONLN);
+		const unsigned cpus = unsigned(online > 0 ? online : 1);
+		spin = (threads <= cpus ? SPIN : 0);
+
+		workers.reserve(threads - 1);
+		for(unsigned w = 1; w < threads; ++w) {
+			workers.push_back(Worker());
+			workers.back().pool = this;
+			workers.back().thread = w;
+			if(pthread_create(&workers.back().handle, 0, &ThreadPool::work, &workers.back()) != 0) {
+				workers.pop_back();
+				break;
+			}
+
+			#ifdef __linux__
+				if(pinned) {
+					cpu_set_t set;
+					CPU_ZERO(&set);
+					CPU_SET((firstCPU + w) % cpus, &set);
+					pthread_setaffinity_np(workers.back().handle, sizeof(set), &set);
+				}
+			#endif
+		}
+	#else
+		(void) firstCPU;
+	#endif
+}
+
+inline ThreadPool::~ThreadPool() {
+	#ifdef _OPENMP
+		pthread_mutex_lock(&mutex);
+		stopping = true;
+		pthread_cond_broadcast(&start);
+		pthread_mutex_unlock(&mutex);
+
+		for(unsigned w = 0; w < workers.size(); ++w) { pthread_join(workers[w].handle, 0); }
+
+		pthread_cond_destroy(&done);
+		pthread_cond_destroy(&start);
+		pthread_mutex_destroy(&mutex);
+	#endif
+}
+
+template< class Task >
+inline void ThreadPool::run(const Task& _task, unsigned _count, unsigned _chunk) {
+	#ifdef _OPENMP
+		if(workers.empty() || _count <= 1) {
+			for(unsigned i = 0; i < _count; ++i) { _task(i, 0); }
+			return;
+		}
+
+		// Publish the loop and wake the workers up:
+		pthread_mutex_lock(&mutex);
+		job = &ThreadPool::invoke< Task >;
+		task = &_task;
+		count = _count;
+		chunk = (_chunk > 0 ? _chunk : 1);
+		next = 0;
+		pending = unsigned(workers.size());
+		++round;
+		pthread_cond_broadcast(&start);
+		pthread_mutex_unlock(&mutex);
+
+		execute(0);
+
+		// Wait for the workers, polling for a while before sleeping:
+		for(unsigned s = 0; s < spin && __sync_add_and_fetch(&pending, 0) > 0; ++s) { }
+
+		pthread_mutex_lock(&mutex);
+		while(pending > 0) { pthread_cond_wait(&done, &mutex); }
+		pthread_mutex_unlock(&mutex);
+	#else
+		(void) _chunk;
+		for(unsigned i = 0; i < _count; ++i) { _task(i, 0); }
+	#endif
+}
+
+inline unsigned ThreadPool::getThreads() const { return threads; }
+
+inline bool ThreadPool::getPinned() const { return pinned; }
+
+template< class Task >
+inline void ThreadPool::invoke(const void* _task, unsigned i, unsigned thread) {
+	(*static_cast< const Task* >(_task))(i, thread);
+}
+
+inline void ThreadPool::execute(unsigned thread) {
+	for( ; ; ) {
+		const unsigned first = __sync_fetch_and_add(&next, chunk);
+		if(first >= count) { return; }
+
+		const unsigned last = (count - first < chunk ? count : first + chunk);
+		for(unsigned i = first; i < last; ++i) { job(task, i, thread); }
+	}
+}
+
+#ifdef _OPENMP
+inline void* ThreadPool::work(void* arg) {
+	const Worker& worker = *static_cast< const Worker* >(arg);
+	ThreadPool& pool = *worker.pool;
+	unsigned long seen = 0;		// Last loop run by this worker
+	for( ; ; ) {
+		// Poll for a new loop for a while before sleeping:
+		for(unsigned s = 0; s < pool.spin; ++s) {
+			if(__sync_add_and_fetch(&pool.round, 0UL) != seen) { break; }
+		}
+
+		pthread_mutex_lock(&pool.mutex);
+		while(pool.round == seen && !pool.stopping) { pthread_cond_wait(&pool.start, &pool.mutex); }
+		if(pool.stopping) { pthread_mutex_unlock(&pool.mutex); break; }
+		seen = pool.round;
+		pthread_mutex_unlock(&pool.mutex);
+
+		pool.execute(worker.thread);
+
+		pthread_mutex_lock(&pool.mutex);
+		if(--pool.pending == 0) { pthread_cond_signal(&pool.done); }
+		pthread_mutex_unlock(&pool.mutex);
+	}
+
+	return 0;
+}
+#endif
+
+#endif
@@ -40,7 +40,7 @@ SampleDecoder::SampleDecoder() { }
 SampleDecoder::~SampleDecoder() { }
 
 // Runs in O(n \log n):
-double SampleDecoder::decode(const std::vector< double >& chromosome) const {
+double SampleDecoder::decode(const Chromosome& chromosome) const {
 	double myFitness = 0.0;
 	typedef std::pair< double, unsigned > ValueKeyPair;
 	std::vector< ValueKeyPair > rank(chromosome.size());
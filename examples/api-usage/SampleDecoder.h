@@ -5,22 +5,28 @@
  * generate a random permutation of {0, 1, ..., n-1} using the supplied chromosome.
  *
  * Any Decoder class must implement either of the methods:
- *     1. double decode(std::vector< double >&)
- *     2. double decode(std::vector< double >&) const
- *     3. double decode(const std::vector< double >&)
- *     4. double decode(const std::vector< double >&) const
- * where the returned double corresponds to the fitness of that chromosome. If parallel decoding
- * is to be used in the BRKGA framework, then decode() *must* be thread-safe; the best way to
- * guarantee this is by via member const-correctness -- see (2) and (4) above --  so that the
- * property will be checked at compile time. An exception to this rule is the use of the mutant
- * modifier in data members of the decoder, which bypasses const-correctness and may introduce
- * dangerous race conditions in a multithreaded environment.
+ *     1. double decode(Chromosome&)
+ *     2. double decode(Chromosome&) const
+ *     3. double decode(const Chromosome&)
+ *     4. double decode(const Chromosome&) const
+ * where the returned double corresponds to the fitness of that chromosome. A Chromosome is a view
+ * over the keys of one chromosome (see brkgaAPI/Chromosome.h) and is used like a vector of doubles.
+ * If parallel decoding is to be used in the BRKGA framework, then decode() *must* be thread-safe;
+ * the best way to guarantee this is by via member const-correctness -- see (2) and (4) above --  so
+ * that the property will be checked at compile time. An exception to this rule is the use of the
+ * mutant modifier in data members of the decoder, which bypasses const-correctness and may
+ * introduce dangerous race conditions in a multithreaded environment.
  *
  * The chromosome inside the BRKGA framework can be changed if desired. To do so, just use the
  * signatures (1) and (3) above which do not forbid the chromosome to be changed (and such change
  * gets reflected in BRKGA). Please use double values in the interval [0,1) when updating, thus
  * obeying the BRKGA guidelines -- for speed, BRKGA does *not* enforce this.
  *
+ * Decoders with a large fixed cost per call may also implement
+ *     void decodeBatch(Chromosome* chromosomes, unsigned n, double* fitness) const
+ * to decode n chromosomes at once (see brkgaAPI/BatchDecoder.h); BRKGA then uses it instead of
+ * decode().
+ *
  * Created on : Nov 17, 2011 by rtoso
  * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
  *              Mauricio G.C. Resende <mgcr@research.att.com>
@@ -57,6 +63,7 @@
 #include <list>
 #include <vector>
 #include <algorithm>
+#include "brkgaAPI/Chromosome.h"
 
 class SampleDecoder {
 public:
@@ -64,7 +71,7 @@ public:
 	~SampleDecoder();	// Destructor
 
 	// Decode a chromosome, returning its fitness as a double-precision floating point:
-	double decode(const std::vector< double >& chromosome) const;
+	double decode(const Chromosome& chromosome) const;
 
 private:
 };
@@ -0,0 +1,132 @@
+/**
+ * BoundedDecoder.h
+ *
+ * Lets decoders stop early on chromosomes that cannot enter the elite set. Besides decode(), a
+ * Decoder may implement
+ *     - double decode(Chromosome& chromosome, double cutoff) const, or
+ *     - double decode(const Chromosome& chromosome, double cutoff) const,
+ * (taking a Workspace& as a third argument if it declares a Workspace; see Workspace.h). BRKGA
+ * then calls it instead of decode(chromosome) with cutoff set to the fitness of the worst elite
+ * chromosome of the population being evolved (or +infinity when decoding a new population). An
+ * offspring whose fitness exceeds the cutoff cannot become elite, so as soon as the decoder knows
+ * that the fitness will be greater than the cutoff (e.g., when a partial cost already is, and
+ * costs only grow from then on) it may stop and return any value greater than the cutoff, such as
+ * the partial cost or std::numeric_limits< double >::infinity(). Such values rank the chromosome
+ * after every elite, which is all BRKGA needs; values not greater than the cutoff must be exact.
+ * The fitness of non-elite chromosomes may thus be a lower bound only. Decoders without this
+ * decode() are unaffected; decodeBatch() is never given a cutoff.
+ *
+ * BoundedDecoder< Decoder, Key >::decode() calls the bounded decode() if there is one and the
+ * plain one otherwise. The choice is made at compile time.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BOUNDEDDECODER_H
+#define BOUNDEDDECODER_H
+
+#include "Chromosome.h"
+#include "Workspace.h"
+
+/**
+ * HasBoundedDecode< Decoder, Key >::value is true iff Decoder declares either decode() above:
+ */
+template< class Decoder, class Key, bool workspace = HasWorkspace< Decoder >::value >
+class HasBoundedDecode {
+	template< class T, double (T::*)(BasicChromosome< Key >&, double) const >
+	struct Check { };
+
+	template< class T, double (T::*)(const BasicChromosome< Key >&, double) const >
+	struct CheckConst { };
+
+	template< class T >
+	static char test(Check< T, &T::decode >*);
+
+	template< class T >
+	static long test(...);
+
+	template< class T >
+	static char testConst(CheckConst< T, &T::decode >*);
+
+	template< class T >
+	static long testConst(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char) ||
+			sizeof(testConst< Decoder >(0)) == sizeof(char)) };
+};
+
+template< class Decoder, class Key >
+class HasBoundedDecode< Decoder, Key, true > {
+	typedef typename Decoder::Workspace Workspace;
+
+	template< class T, double (T::*)(BasicChromosome< Key >&, double, Workspace&) const >
+	struct Check { };
+
+	template< class T, double (T::*)(const BasicChromosome< Key >&, double, Workspace&) const >
+	struct CheckConst { };
+
+	template< class T >
+	static char test(Check< T, &T::decode >*);
+
+	template< class T >
+	static long test(...);
+
+	template< class T >
+	static char testConst(CheckConst< T, &T::decode >*);
+
+	template< class T >
+	static long testConst(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char) ||
+			sizeof(testConst< Decoder >(0)) == sizeof(char)) };
+};
+
+template< class Decoder, class Key, bool bounded = HasBoundedDecode< Decoder, Key >::value >
+struct BoundedDecoder {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+
+	static double decode(const Decoder& decoder, BasicChromosome< Key >& chromosome, double,
+			Workspace& workspace) {
+		return WorkspaceTraits< Decoder >::decode(decoder, chromosome, workspace);
+	}
+};
+
+template< class Decoder, class Key >
+struct BoundedDecoder< Decoder, Key, true > {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+
+	static double decode(const Decoder& decoder, BasicChromosome< Key >& chromosome,
+			double cutoff, Workspace& workspace) {
+		return WorkspaceTraits< Decoder >::decodeBounded(decoder, chromosome, cutoff, workspace);
+	}
+};
+
+#endif
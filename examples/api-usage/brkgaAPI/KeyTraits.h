@@ -0,0 +1,172 @@
+/**
+ * KeyTraits.h
+ *
+ * Describes how random keys of type Key are stored, drawn and read back as real numbers in [0,1).
+ * BRKGA, Population and Chromosome are parameterized on Key; the following types are supported:
+ *
+ * - double: 53-bit keys (the default), drawn with RNG::rand().
+ * - float: 24-bit keys, drawn with RNG::rand() and rounded down to the largest float below 1.
+ * - unsigned int: 32-bit fixed-point keys, where k represents k / 2^32, drawn with RNG::randInt().
+ * - unsigned short: 16-bit fixed-point keys, where k represents k / 2^16, drawn with the 16 most
+ *   significant bits of RNG::randInt().
+ *
+ * Narrower keys halve (float, unsigned int) or quarter (unsigned short) the memory used by the
+ * populations and the memory traffic when mating. Since the order of the keys is preserved, any
+ * decoder that only sorts or thresholds keys produces the same kind of solutions; note, however,
+ * that fixed-point keys make ties more likely (e.g., among the 2^16 values of unsigned short).
+ *
+ * Each specialization implements:
+ * - static double toDouble(Key k): the real number in [0,1) represented by k
+ * - static Key fromDouble(double x): the key closest to x in [0,1), clamped into range
+ * - static Key random(RNG& rng): a uniformly distributed key
+ * - static void fill(RNG& rng, Key* keys, unsigned n): n keys, the same as n calls to random(),
+ *   drawn in bulk (see BulkRandom.h)
+ * - typedef Reference: what Chromosome::operator[] returns to let decoders change a key using
+ *   real numbers in [0,1); Key& for floating point keys, QuantizedKeyReference for fixed point.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef KEYTRAITS_H
+#define KEYTRAITS_H
+
+#include <limits>
+#include "BulkRandom.h"
+
+template< class Key >
+struct KeyTraits;
+
+/**
+ * Reference to a fixed-point key that reads and writes real numbers in [0,1).
+ */
+template< class Key >
+class QuantizedKeyReference {
+public:
+	explicit QuantizedKeyReference(Key& _key) : key(_key) { }
+
+	operator double() const { return KeyTraits< Key >::toDouble(key); }
+
+	QuantizedKeyReference& operator=(double x) {
+		key = KeyTraits< Key >::fromDouble(x);
+		return *this;
+	}
+
+	QuantizedKeyReference& operator=(const QuantizedKeyReference& other) {
+		key = other.key;
+		return *this;
+	}
+
+private:
+	Key& key;
+};
+
+/**
+ * Fixed-point keys: k represents k / 2^BITS, where BITS is the number of bits in Key.
+ */
+template< class Key >
+struct QuantizedKeyTraits {
+	typedef QuantizedKeyReference< Key > Reference;
+
+	static const int BITS = std::numeric_limits< Key >::digits;
+
+	static double toDouble(Key k) { return double(k) * (1.0 / (double(1UL << (BITS - 1)) * 2.0)); }
+
+	static Key fromDouble(double x) {
+		if(x <= 0.0) { return Key(0); }
+		const double scaled = x * (double(1UL << (BITS - 1)) * 2.0);
+		if(scaled >= double(std::numeric_limits< Key >::max())) {
+			return std::numeric_limits< Key >::max();
+		}
+
+		return Key(scaled);
+	}
+
+	template< class RNG >
+	static Key random(RNG& rng) { return Key((rng.randInt() & 0xffffffffUL) >> (32 - BITS)); }
+
+	template< class RNG >
+	static void fill(RNG& rng, Key* keys, unsigned n) {
+		unsigned int words[256];
+		for(unsigned i = 0; i < n; i += 256) {
+			const unsigned count = (n - i < 256 ? n - i : 256);
+			BulkRandom< RNG >::fillUInt32(rng, words, count);
+			for(unsigned j = 0; j < count; ++j) { keys[i + j] = Key(words[j] >> (32 - BITS)); }
+		}
+	}
+};
+
+template<>
+struct KeyTraits< double > {
+	typedef double& Reference;
+
+	static double toDouble(double k) { return k; }
+	static double fromDouble(double x) { return x; }
+
+	template< class RNG >
+	static double random(RNG& rng) { return rng.rand(); }
+
+	template< class RNG >
+	static void fill(RNG& rng, double* keys, unsigned n) { BulkRandom< RNG >::fill(rng, keys, n); }
+};
+
+template<>
+struct KeyTraits< float > {
+	typedef float& Reference;
+
+	static double toDouble(float k) { return double(k); }
+
+	static float fromDouble(double x) {
+		const float k = float(x);
+		if(!(k > 0.0f)) { return 0.0f; }	// Also maps NaN and -0 to 0
+		return (k < 1.0f ? k : 1.0f - std::numeric_limits< float >::epsilon() / 2.0f);
+	}
+
+	template< class RNG >
+	static float random(RNG& rng) { return fromDouble(rng.rand()); }
+
+	template< class RNG >
+	static void fill(RNG& rng, float* keys, unsigned n) {
+		double values[256];
+		for(unsigned i = 0; i < n; i += 256) {
+			const unsigned count = (n - i < 256 ? n - i : 256);
+			BulkRandom< RNG >::fill(rng, values, count);
+			for(unsigned j = 0; j < count; ++j) { keys[i + j] = fromDouble(values[j]); }
+		}
+	}
+};
+
+template<>
+struct KeyTraits< unsigned int > : public QuantizedKeyTraits< unsigned int > {
+};
+
+template<>
+struct KeyTraits< unsigned short > : public QuantizedKeyTraits< unsigned short > {
+};
+
+#endif
@@ -7,6 +7,11 @@
 //    53-bit real number in [0,1)
 // 3. Updated the constructors to initialize members pNext and left in the
 //    member initialization list
+// 4. Added bulk generation: fill() and fillUInt32() return the same numbers as
+//    repeated calls to rand() and randInt(), but temper whole blocks of the
+//    state at once; reload() was rewritten without branches so that both loops
+//    are vectorized by the compiler (e.g., g++ -O3), which makes this a SIMD
+//    Mersenne Twister that keeps the MT19937 sequence
 // Rodrigo Franco Toso (rtoso@cs.rutgers.edu)
 // Mauricio G.C. Resende (mgcr@research.att.com)
 
@@ -120,6 +125,10 @@ public:
 	double rand();		// calls rand53() -- modified by rtoso
 	double rand53();  	// real number in [0,1)
 	
+	// Bulk access: same values as n calls to rand() or to randInt() (low 32 bits)
+	void fill( double* out, unsigned n );
+	void fillUInt32( unsigned int* out, unsigned n );
+	
 	// Access to nonuniform random number distributions
 	double randNorm( const double mean = 0.0, const double stddev = 1.0 );
 	
@@ -146,6 +155,16 @@ protected:
 		{ return loBit(u) ? 0x9908b0dfUL : 0x0UL; }
 	uint32 twist( const uint32 m, const uint32 s0, const uint32 s1 ) const
 		{ return m ^ (mixBits(s0,s1)>>1) ^ magic(s1); }
+	static uint32 twistNoBranch( const uint32 m, const uint32 s0, const uint32 s1 )
+		{ return m ^ (((s0 & 0x80000000UL) | (s1 & 0x7fffffffUL)) >> 1)
+				^ ((0UL - (s1 & 0x00000001UL)) & 0x9908b0dfUL); }
+	static uint32 temper( uint32 s1 )
+	{
+		s1 ^= (s1 >> 11);
+		s1 ^= (s1 <<  7) & 0x9d2c5680UL;
+		s1 ^= (s1 << 15) & 0xefc60000UL;
+		return ( s1 ^ (s1 >> 18) );
+	}
 	static uint32 hash( time_t t, clock_t c );
 };
 
@@ -197,14 +216,17 @@ inline void MTRand::reload()
 {
 	// Generate N new values in state
 	// Made clearer and faster by Matthew Bellew (matthew.bellew@home.com)
+	// Indexed and branch-free so that both loops are vectorized: within
+	// each loop, state[i] only depends on values that are at least N - M
+	// positions away from the ones being updated -- modified for bulk access
 	static const int MmN = int(M) - int(N);  // in case enums are unsigned
-	register uint32 *p = state;
-	register int i;
-	for( i = N - M; i--; ++p )
-		*p = twist( p[M], p[0], p[1] );
-	for( i = M; --i; ++p )
-		*p = twist( p[MmN], p[0], p[1] );
-	*p = twist( p[MmN], p[0], state[0] );
+	uint32 *const p = state;
+	int i = 0;
+	for( ; i < N - M; ++i )
+		p[i] = twistNoBranch( p[i+M], p[i], p[i+1] );
+	for( ; i < N - 1; ++i )
+		p[i] = twistNoBranch( p[i+MmN], p[i], p[i+1] );
+	p[N-1] = twistNoBranch( p[N-1+MmN], p[N-1], state[0] );
 	
 	left = N, pNext = state;
 }
@@ -274,12 +296,7 @@ inline MTRand::uint32 MTRand::randInt()
 	if( left == 0 ) reload();
 	--left;
 	
-	register uint32 s1;
-	s1 = *pNext++;
-	s1 ^= (s1 >> 11);
-	s1 ^= (s1 <<  7) & 0x9d2c5680UL;
-	s1 ^= (s1 << 15) & 0xefc60000UL;
-	return ( s1 ^ (s1 >> 18) );
+	return temper( *pNext++ );
 }
 
 inline MTRand::uint32 MTRand::randInt( const uint32 n )
@@ -328,6 +345,37 @@ inline double MTRand::rand53()
 inline double MTRand::rand()
 	{ return rand53(); }
 
+inline void MTRand::fillUInt32( unsigned int* out, unsigned n )
+{
+	// Temper the state in blocks of up to N values, reloading in between
+	while( n > 0 )
+	{
+		if( left == 0 ) reload();
+		const int count = ( int(n) < left ? int(n) : left );
+		const uint32 *const s = pNext;
+		for( int i = 0; i < count; ++i )
+			out[i] = (unsigned int)( temper( s[i] ) & 0xffffffffUL );
+		pNext += count;  left -= count;
+		out += count;  n -= unsigned(count);
+	}
+}
+
+inline void MTRand::fill( double* out, unsigned n )
+{
+	// Each double takes two consecutive 32-bit values, just as in rand53()
+	static const unsigned CHUNK = 256;
+	unsigned int words[2 * CHUNK];
+	while( n > 0 )
+	{
+		const unsigned count = ( n < CHUNK ? n : CHUNK );
+		fillUInt32( words, 2 * count );
+		for( unsigned i = 0; i < count; ++i )
+			out[i] = ( (words[2*i] >> 5) * 67108864.0 + (words[2*i+1] >> 6) )
+					* (1.0/9007199254740992.0);
+		out += count;  n -= count;
+	}
+}
+
 inline double MTRand::randNorm( const double mean, const double stddev )
 {
 	// Return a real number from a normal (Gaussian) distribution with given
@@ -0,0 +1,68 @@
+/**
+ * AsyncSampleDecoder.h
+ *
+ * Decodes chromosomes like SampleDecoder (see examples/api-usage), except that the fitness is
+ * computed by the processes of a MockEvaluator. Besides decode(), which blocks until the fitness
+ * is known, it implements the asynchronous interface of brkgaAPI/AsyncDecoder.h:
+ *     - Request submit(const Chromosome& chromosome) const
+ *     - bool complete(Request& request, double& fitness, bool wait) const
+ * so that BRKGA can keep as many chromosomes in flight as there are evaluator processes (see
+ * BRKGA::setAsyncDecoding()), even with a single thread.
+ *
+ * Created on : Oct 17, 2026
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef ASYNCSAMPLEDECODER_H
+#define ASYNCSAMPLEDECODER_H
+
+#include "MockEvaluator.h"
+#include "brkgaAPI/Chromosome.h"
+
+class AsyncSampleDecoder {
+public:
+	typedef unsigned Request;	// Evaluator process that has the chromosome
+
+	explicit AsyncSampleDecoder(MockEvaluator& evaluator);	// Constructor
+	~AsyncSampleDecoder();	// Destructor
+
+	// Starts decoding a chromosome:
+	Request submit(const Chromosome& chromosome) const;
+
+	// Returns true and sets its fitness once the chromosome of 'request' is decoded:
+	bool complete(Request& request, double& fitness, bool wait) const;
+
+	// Decodes a chromosome, returning its fitness as a double-precision floating point:
+	double decode(const Chromosome& chromosome) const;
+
+private:
+	MockEvaluator& evaluator;
+};
+
+#endif
@@ -0,0 +1,179 @@
+/*
+ * MockEvaluator.cpp
+ *
+ * For more information, see MockEvaluator.h
+ *
+ * Created on : Oct 17, 2026
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "MockEvaluator.h"
+#include <poll.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <stdexcept>
+
+MockEvaluator::MockEvaluator(unsigned n, unsigned latency) : processes(), idle(), mutex(),
+		released() {
+	processes.reserve(n);	// So that nothing below throws but the failures handled by fail()
+	idle.reserve(n);
+	pthread_mutex_init(&mutex, 0);
+	pthread_cond_init(&released, 0);
+
+	for(unsigned i = 0; i < n; ++i) {
+		int requests[2], replies[2];
+		if(pipe(requests) != 0) { fail("Cannot create pipe."); }
+		if(pipe(replies) != 0) {
+			close(requests[0]);
+			close(requests[1]);
+			fail("Cannot create pipe.");
+		}
+
+		const pid_t pid = fork();
+		if(pid < 0) {
+			close(requests[0]);
+			close(requests[1]);
+			close(replies[0]);
+			close(replies[1]);
+			fail("Cannot start evaluator process.");
+		}
+
+		if(pid == 0) {
+			// Close the pipes of the other processes, so that they see the end of their input:
+			for(unsigned j = 0; j < processes.size(); ++j) {
+				close(processes[j].requests);
+				close(processes[j].replies);
+			}
+
+			close(requests[1]);
+			close(replies[0]);
+			serve(requests[0], replies[1], latency);
+			_exit(0);
+		}
+
+		close(requests[0]);
+		close(replies[1]);
+		Process process = { pid, requests[1], replies[0] };
+		processes.push_back(process);
+		idle.push_back(i);
+	}
+}
+
+MockEvaluator::~MockEvaluator() { shutdown(); }
+
+void MockEvaluator::shutdown() {
+	for(unsigned i = 0; i < processes.size(); ++i) { close(processes[i].requests); }
+	for(unsigned i = 0; i < processes.size(); ++i) {
+		waitpid(processes[i].pid, 0, 0);
+		close(processes[i].replies);
+	}
+
+	pthread_cond_destroy(&released);
+	pthread_mutex_destroy(&mutex);
+}
+
+void MockEvaluator::fail(const char* message) {
+	shutdown();
+	throw std::runtime_error(message);
+}
+
+void MockEvaluator::release(unsigned process) {
+	pthread_mutex_lock(&mutex);
+	idle.push_back(process);
+	pthread_cond_signal(&released);
+	pthread_mutex_unlock(&mutex);
+}
+
+unsigned MockEvaluator::send(const double* keys, unsigned n) {
+	pthread_mutex_lock(&mutex);
+	while(idle.empty()) { pthread_cond_wait(&released, &mutex); }
+	const unsigned process = idle.back();
+	idle.pop_back();
+	pthread_mutex_unlock(&mutex);
+
+	if(!writeAll(processes[process].requests, &n, sizeof(n)) ||
+			!writeAll(processes[process].requests, keys, unsigned(n * sizeof(double)))) {
+		release(process);	// Or no thread could ever take it again
+		throw std::runtime_error("Cannot send chromosome to evaluator process.");
+	}
+
+	return process;
+}
+
+bool MockEvaluator::receive(unsigned process, double& fitness, bool wait) {
+	pollfd reply = { processes[process].replies, POLLIN, 0 };
+	if(poll(&reply, 1, wait ? -1 : 0) <= 0) { return false; }
+
+	const bool received = readAll(processes[process].replies, &fitness, sizeof(fitness));
+	release(process);
+	if(!received) { throw std::runtime_error("Cannot receive fitness from evaluator process."); }
+
+	return true;
+}
+
+unsigned MockEvaluator::getProcesses() const { return unsigned(processes.size()); }
+
+void MockEvaluator::serve(int requests, int replies, unsigned latency) {
+	std::vector< double > keys;
+	unsigned n;
+	while(readAll(requests, &n, sizeof(n))) {
+		keys.resize(n);
+		if(n > 0 && !readAll(requests, &keys[0], unsigned(n * sizeof(double)))) { break; }
+
+		usleep(latency);	// The simulation
+
+		double fitness = 0.0;
+		for(unsigned i = 0; i < n; ++i) { fitness += (double(i + 1) * keys[i]); }
+		if(!writeAll(replies, &fitness, sizeof(fitness))) { break; }
+	}
+}
+
+bool MockEvaluator::readAll(int fd, void* data, unsigned bytes) {
+	char* next = static_cast< char* >(data);
+	while(bytes > 0) {
+		const ssize_t got = read(fd, next, bytes);
+		if(got <= 0) { return false; }
+		next += got;
+		bytes -= unsigned(got);
+	}
+
+	return true;
+}
+
+bool MockEvaluator::writeAll(int fd, const void* data, unsigned bytes) {
+	const char* next = static_cast< const char* >(data);
+	while(bytes > 0) {
+		const ssize_t put = write(fd, next, bytes);
+		if(put <= 0) { return false; }
+		next += put;
+		bytes -= unsigned(put);
+	}
+
+	return true;
+}
@@ -0,0 +1,89 @@
+/**
+ * MockEvaluator.h
+ *
+ * Stands in for an external evaluator (e.g., a simulation running in another process): it forks
+ * a number of evaluator processes, each of which reads chromosomes from a pipe, waits 'latency'
+ * microseconds to simulate the work, and writes back the fitness sum_i (x_i * i) computed by
+ * SampleDecoder. A process evaluates one chromosome at a time; send() hands a chromosome to an
+ * idle process and receive() collects its reply, so many chromosomes can be evaluated at once.
+ * send() and receive() are thread-safe. The processes are stopped by the destructor.
+ *
+ * Uses POSIX fork(), pipes and poll().
+ *
+ * Created on : Oct 17, 2026
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef MOCKEVALUATOR_H
+#define MOCKEVALUATOR_H
+
+#include <vector>
+#include <pthread.h>
+#include <sys/types.h>
+
+class MockEvaluator {
+public:
+	// Starts 'processes' evaluator processes taking 'latency' microseconds per chromosome:
+	MockEvaluator(unsigned processes, unsigned latency);
+	~MockEvaluator();	// Stops the processes
+
+	// Sends keys[0], ..., keys[n - 1] to an idle process (waiting for one if they are all busy)
+	// and returns that process:
+	unsigned send(const double* keys, unsigned n);
+
+	// Returns true and sets 'fitness' if 'process' has replied, and false otherwise (unless 'wait'
+	// is set, in which case it waits for the reply); the process is then idle again:
+	bool receive(unsigned process, double& fitness, bool wait);
+
+	unsigned getProcesses() const;	// Number of evaluator processes
+
+private:
+	struct Process {
+		pid_t pid;
+		int requests;	// Pipe to the process
+		int replies;	// Pipe from the process
+	};
+
+	void shutdown();				// Stops the processes started so far and frees the sync objects
+	void fail(const char* message);	// Calls shutdown() and throws std::runtime_error(message)
+	void release(unsigned process);	// Makes 'process' idle again
+	static void serve(int requests, int replies, unsigned latency);	// Body of the processes
+	static bool readAll(int fd, void* data, unsigned bytes);
+	static bool writeAll(int fd, const void* data, unsigned bytes);
+
+	std::vector< Process > processes;
+	std::vector< unsigned > idle;	// Processes with no chromosome to evaluate
+	pthread_mutex_t mutex;			// Protects 'idle'
+	pthread_cond_t released;		// Signaled when a process becomes idle
+
+	MockEvaluator(const MockEvaluator&);				// Not allowed
+	MockEvaluator& operator=(const MockEvaluator&);		// Not allowed
+};
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * async-usage.cpp
+ *
+ * Driver showing how to decode chromosomes asynchronously with the BRKGA API: the fitness of each
+ * chromosome is computed by an external evaluator with a fixed latency (see MockEvaluator.h and
+ * AsyncSampleDecoder.h). The same run is made with a blocking decode() and then with up to
+ * 'inFlight' evaluations in flight; since both decode exactly, they find the same solution, but
+ * the latter waits on many evaluations at a time.
+ *
+ * Created on : Oct 17, 2026
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <iostream>
+#include <sys/time.h>
+#include "brkgaAPI/BRKGA.h"
+#include "brkgaAPI/MTRand.h"
+#include "MockEvaluator.h"
+#include "AsyncSampleDecoder.h"
+
+// Wall-clock time in seconds:
+double now() {
+	timeval time;
+	gettimeofday(&time, 0);
+	return time.tv_sec + 1e-6 * time.tv_usec;
+}
+
+int main() {
+	std::cout << "Welcome to the BRKGA API asynchronous driver.\nFinding a (heuristic) minimizer "
+			<< "for f(x) = sum_i (x_i * i) where x \\in [0,1)^n." << std::endl;
+
+	const unsigned n = 10;		// size of chromosomes
+	const unsigned p = 100;		// size of population
+	const double pe = 0.10;		// fraction of population to be the elite-set
+	const double pm = 0.10;		// fraction of population to be replaced by mutants
+	const double rhoe = 0.70;	// probability that offspring inherit an allele from elite parent
+	const unsigned K = 1;		// number of independent populations
+	const unsigned MAXT = 1;	// number of threads for parallel decoding
+	const unsigned MAX_GENS = 20;	// run for 20 gens
+
+	const unsigned inFlight = 32;	// evaluations in flight
+	const unsigned latency = 1000;	// microseconds per evaluation
+	MockEvaluator evaluator(inFlight, latency);	// start the evaluator processes
+	AsyncSampleDecoder decoder(evaluator);		// initialize the decoder
+
+	const long unsigned rngSeed = 0;	// seed to the random number generator
+	for(unsigned async = 0; async < 2; ++async) {
+		MTRand rng(rngSeed);	// initialize the random number generator
+		const double start = now();
+
+		// initialize the BRKGA-based heuristic, which decodes the first populations:
+		BRKGA< AsyncSampleDecoder, MTRand > algorithm(n, p, pe, pm, rhoe, decoder, rng, K, MAXT);
+		if(async) { algorithm.setAsyncDecoding(true, inFlight); }
+
+		algorithm.evolve(MAX_GENS);	// evolve the population for MAX_GENS generations
+
+		std::cout << (async ? "Asynchronous" : "Blocking") << " decoding: best solution found "
+				<< "has objective value = " << algorithm.getBestFitness() << " ("
+				<< now() - start << " s)" << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,162 @@
+/**
+ * AsyncDecoder.h
+ *
+ * Lets decoders that wait on something else (e.g., a simulation running in another process) keep
+ * many evaluations in flight instead of blocking a thread on each one (see
+ * BRKGA::setAsyncDecoding()). Besides decode(), a Decoder may declare a nested type Request
+ * (default constructible and assignable), which identifies an evaluation in progress, and
+ * implement
+ *     - Request submit(Chromosome& chromosome) const, or
+ *     - Request submit(const Chromosome& chromosome) const,
+ *       which starts evaluating 'chromosome' and returns at once, and
+ *     - bool complete(Request& request, double& fitness, bool wait) const,
+ *       which returns true and sets 'fitness' to decode(chromosome) if the evaluation of
+ *       'request' has finished, and returns false otherwise, unless 'wait' is set, in which case
+ *       it waits for the evaluation to finish. complete() returns true only once per request.
+ * The chromosome stays in place until its request completes, so submit() may keep a reference to
+ * it and change it before then. BRKGA submits from one thread per population and completes each
+ * request from the thread that submitted it, but populations evolved in parallel (see
+ * setParallelIslands()) submit concurrently, so submit() and complete() must then be thread-safe,
+ * and up to K times the limit set by setAsyncDecoding() may be in flight at once. An evaluator
+ * whose submit() waits for free capacity must offer at least that much, since a thread waiting
+ * in submit() completes none of its own requests meanwhile.
+ *
+ * AsyncDecoder< Decoder, Key >::submit() and complete() call those of Decoder if it has them;
+ * otherwise submit() decodes the chromosome right away and complete() returns its fitness. The
+ * choice is made at compile time.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef ASYNCDECODER_H
+#define ASYNCDECODER_H
+
+#include "Chromosome.h"
+#include "Workspace.h"
+
+/**
+ * HasRequest< Decoder >::value is true iff Decoder declares a nested type Request:
+ */
+template< class Decoder >
+class HasRequest {
+	template< class T >
+	static char test(typename T::Request*);
+
+	template< class T >
+	static long test(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char)) };
+};
+
+/**
+ * HasAsyncDecode< Decoder, Key >::value is true iff Decoder declares Request, submit() and
+ * complete() above:
+ */
+template< class Decoder, class Key, bool request = HasRequest< Decoder >::value >
+class HasAsyncDecode {
+public:
+	enum { value = false };
+};
+
+template< class Decoder, class Key >
+class HasAsyncDecode< Decoder, Key, true > {
+	typedef typename Decoder::Request Request;
+
+	template< class T, Request (T::*)(BasicChromosome< Key >&) const >
+	struct Check { };
+
+	template< class T, Request (T::*)(const BasicChromosome< Key >&) const >
+	struct CheckConst { };
+
+	template< class T, bool (T::*)(Request&, double&, bool) const >
+	struct CheckComplete { };
+
+	template< class T >
+	static char test(Check< T, &T::submit >*);
+
+	template< class T >
+	static long test(...);
+
+	template< class T >
+	static char testConst(CheckConst< T, &T::submit >*);
+
+	template< class T >
+	static long testConst(...);
+
+	template< class T >
+	static char testComplete(CheckComplete< T, &T::complete >*);
+
+	template< class T >
+	static long testComplete(...);
+
+public:
+	enum { value = ((sizeof(test< Decoder >(0)) == sizeof(char) ||
+			sizeof(testConst< Decoder >(0)) == sizeof(char)) &&
+			sizeof(testComplete< Decoder >(0)) == sizeof(char)) };
+};
+
+template< class Decoder, class Key, bool async = HasAsyncDecode< Decoder, Key >::value >
+struct AsyncDecoder {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+
+	struct Request {	// The fitness, known as soon as the chromosome is submitted
+		Request() : fitness(0.0) { }
+		double fitness;
+	};
+
+	static Request submit(const Decoder& decoder, BasicChromosome< Key >& chromosome,
+			Workspace& workspace) {
+		Request request;
+		request.fitness = WorkspaceTraits< Decoder >::decode(decoder, chromosome, workspace);
+		return request;
+	}
+
+	static bool complete(const Decoder&, Request& request, double& fitness, bool) {
+		fitness = request.fitness;
+		return true;
+	}
+};
+
+template< class Decoder, class Key >
+struct AsyncDecoder< Decoder, Key, true > {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+	typedef typename Decoder::Request Request;
+
+	static Request submit(const Decoder& decoder, BasicChromosome< Key >& chromosome,
+			Workspace&) {
+		return decoder.submit(chromosome);
+	}
+
+	static bool complete(const Decoder& decoder, Request& request, double& fitness, bool wait) {
+		return decoder.complete(request, fitness, wait);
+	}
+};
+
+#endif
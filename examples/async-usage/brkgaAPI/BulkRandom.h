@@ -0,0 +1,80 @@
+/**
+ * BulkRandom.h
+ *
+ * Draws many random numbers at once from an RNG. If RNG offers the optional bulk methods
+ *     - void fill(double* out, unsigned n): same values as n calls to rand()
+ *     - void fillUInt32(unsigned int* out, unsigned n): same values as n calls to randInt()
+ *       (keeping the low 32 bits)
+ * as MTRand does, BulkRandom< RNG > calls them; otherwise it falls back to calling rand() or
+ * randInt() n times. The choice is made at compile time, and both give the same numbers, so
+ * results do not depend on whether an RNG implements the bulk methods.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BULKRANDOM_H
+#define BULKRANDOM_H
+
+/**
+ * HasBulkMethods< RNG >::value is true iff RNG declares both fill() and fillUInt32() as above:
+ */
+template< class RNG >
+class HasBulkMethods {
+	template< class T, void (T::*)(double*, unsigned), void (T::*)(unsigned int*, unsigned) >
+	struct Check { };
+
+	template< class T >
+	static char test(Check< T, &T::fill, &T::fillUInt32 >*);
+
+	template< class T >
+	static long test(...);
+
+public:
+	enum { value = (sizeof(test< RNG >(0)) == sizeof(char)) };
+};
+
+template< class RNG, bool bulk = HasBulkMethods< RNG >::value >
+struct BulkRandom {
+	static void fill(RNG& rng, double* out, unsigned n) {
+		for(unsigned i = 0; i < n; ++i) { out[i] = rng.rand(); }
+	}
+
+	static void fillUInt32(RNG& rng, unsigned int* out, unsigned n) {
+		for(unsigned i = 0; i < n; ++i) { out[i] = (unsigned int) (rng.randInt() & 0xffffffffUL); }
+	}
+};
+
+template< class RNG >
+struct BulkRandom< RNG, true > {
+	static void fill(RNG& rng, double* out, unsigned n) { rng.fill(out, n); }
+
+	static void fillUInt32(RNG& rng, unsigned int* out, unsigned n) { rng.fillUInt32(out, n); }
+};
+
+#endif
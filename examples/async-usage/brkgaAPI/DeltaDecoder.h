@@ -0,0 +1,183 @@
+/**
+ * DeltaDecoder.h
+ *
+ * Lets decoders evaluate an offspring incrementally from the decoded state of its elite parent
+ * (see BRKGA::setDeltaDecoding()). Since an offspring inherits each gene from its elite parent
+ * with probability rhoe, it often differs from that parent in a few genes only. A Decoder may
+ * declare a nested type State, which holds whatever decode() builds from a chromosome (e.g., the
+ * sorted permutation of a TSP tour), and implement
+ *     - double decodeDelta(Chromosome& chromosome, const State* parent, const unsigned* genes,
+ *       unsigned count, State& state) const, or the same with const Chromosome& chromosome,
+ * (taking a Workspace& as the last argument if it declares a Workspace; see Workspace.h). It must
+ * return decode(chromosome) and store the state of chromosome in 'state' (as changed, if it changes
+ * the chromosome like decode() may). If 'parent' is 0, it decodes from scratch; otherwise 'parent'
+ * is the state of a chromosome that differs from this one exactly in genes genes[0] < genes[1] <
+ * ... < genes[count - 1], which the decoder may use to rebuild only what changed. BRKGA keeps one
+ * State per chromosome of each population (and of its previous generation), so State should be
+ * cheap to hold and must be default constructible and assignable; it is only ever written by the
+ * thread decoding its chromosome.
+ *
+ * DeltaDecoder< Decoder, Key >::decode() calls decodeDelta() if Decoder has one and decode()
+ * otherwise, and DeltaTraits< Decoder >::State is the State of Decoder (NoState if it has none).
+ * The choices are made at compile time.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef DELTADECODER_H
+#define DELTADECODER_H
+
+#include "Chromosome.h"
+#include "Workspace.h"
+
+/**
+ * HasState< Decoder >::value is true iff Decoder declares a nested type State:
+ */
+template< class Decoder >
+class HasState {
+	template< class T >
+	static char test(typename T::State*);
+
+	template< class T >
+	static long test(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char)) };
+};
+
+/**
+ * State of decoders that do not declare one:
+ */
+struct NoState {
+};
+
+template< class Decoder, bool state = HasState< Decoder >::value >
+struct DeltaTraits {
+	typedef NoState State;
+};
+
+template< class Decoder >
+struct DeltaTraits< Decoder, true > {
+	typedef typename Decoder::State State;
+};
+
+/**
+ * HasDeltaDecode< Decoder, Key >::value is true iff Decoder declares State and decodeDelta() above:
+ */
+template< class Decoder, class Key, bool state = HasState< Decoder >::value,
+		bool workspace = HasWorkspace< Decoder >::value >
+class HasDeltaDecode {
+public:
+	enum { value = false };
+};
+
+template< class Decoder, class Key >
+class HasDeltaDecode< Decoder, Key, true, false > {
+	typedef typename Decoder::State State;
+
+	template< class T, double (T::*)(BasicChromosome< Key >&, const State*, const unsigned*,
+			unsigned, State&) const >
+	struct Check { };
+
+	template< class T, double (T::*)(const BasicChromosome< Key >&, const State*,
+			const unsigned*, unsigned, State&) const >
+	struct CheckConst { };
+
+	template< class T >
+	static char test(Check< T, &T::decodeDelta >*);
+
+	template< class T >
+	static long test(...);
+
+	template< class T >
+	static char testConst(CheckConst< T, &T::decodeDelta >*);
+
+	template< class T >
+	static long testConst(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char) ||
+			sizeof(testConst< Decoder >(0)) == sizeof(char)) };
+};
+
+template< class Decoder, class Key >
+class HasDeltaDecode< Decoder, Key, true, true > {
+	typedef typename Decoder::State State;
+	typedef typename Decoder::Workspace Workspace;
+
+	template< class T, double (T::*)(BasicChromosome< Key >&, const State*, const unsigned*,
+			unsigned, State&, Workspace&) const >
+	struct Check { };
+
+	template< class T, double (T::*)(const BasicChromosome< Key >&, const State*,
+			const unsigned*, unsigned, State&, Workspace&) const >
+	struct CheckConst { };
+
+	template< class T >
+	static char test(Check< T, &T::decodeDelta >*);
+
+	template< class T >
+	static long test(...);
+
+	template< class T >
+	static char testConst(CheckConst< T, &T::decodeDelta >*);
+
+	template< class T >
+	static long testConst(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char) ||
+			sizeof(testConst< Decoder >(0)) == sizeof(char)) };
+};
+
+template< class Decoder, class Key, bool delta = HasDeltaDecode< Decoder, Key >::value >
+struct DeltaDecoder {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+	typedef typename DeltaTraits< Decoder >::State State;
+
+	static double decode(const Decoder& decoder, BasicChromosome< Key >& chromosome,
+			const State*, const unsigned*, unsigned, State&, Workspace& workspace) {
+		return WorkspaceTraits< Decoder >::decode(decoder, chromosome, workspace);
+	}
+};
+
+template< class Decoder, class Key >
+struct DeltaDecoder< Decoder, Key, true > {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+	typedef typename DeltaTraits< Decoder >::State State;
+
+	static double decode(const Decoder& decoder, BasicChromosome< Key >& chromosome,
+			const State* parent, const unsigned* genes, unsigned count, State& state,
+			Workspace& workspace) {
+		return WorkspaceTraits< Decoder >::decodeDelta(decoder, chromosome, parent, genes, count,
+				state, workspace);
+	}
+};
+
+#endif
@@ -0,0 +1,178 @@
+/**
+ * Population.cpp
+ *
+ * For details, see Population.h
+ *
+ * Created on : Jun 21, 2010 by rtoso
+ * Last update: Mar 15, 2013 by rtoso
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ * Copyright 2010, 2011 Rodrigo Franco Toso and Mauricio G.C. Resende.
+ * 
+ * This file is part of the BRKGA API.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Population.h"
+
+template< class Key >
+BasicPopulation< Key >::BasicPopulation(const BasicPopulation& pop) :
+		n(pop.n), p(pop.p), stride(pop.stride), storage(0), keys(0), population(),
+		fitness(pop.fitness), sorted(pop.sorted), cost(pop.cost) {
+	allocate();
+	for(unsigned i = 0; i < p; ++i) {
+		std::copy(pop.population[i].begin(), pop.population[i].end(), population[i].begin());
+	}
+}
+
+template< class Key >
+BasicPopulation< Key >::BasicPopulation(const unsigned _n, const unsigned _p) :
+		n(_n), p(_p),
+		stride(((_n + ALIGNMENT / sizeof(Key) - 1) / (ALIGNMENT / sizeof(Key)))
+				* (ALIGNMENT / sizeof(Key))),
+		storage(0), keys(0), population(), fitness(_p), sorted(0), cost(_p, 0.0) {
+	if(p == 0) { throw std::range_error("Population size p cannot be zero."); }
+	if(n == 0) { throw std::range_error("Chromosome size n cannot be zero."); }
+
+	allocate();
+	std::fill(keys, keys + std::size_t(p) * stride, Key(0));
+}
+
+template< class Key >
+BasicPopulation< Key >::~BasicPopulation() {
+	delete[] storage;
+}
+
+template< class Key >
+void BasicPopulation< Key >::allocate() {
+	// Over-allocate by one alignment unit so that the first row can start at an aligned address:
+	const std::size_t padding = ALIGNMENT / sizeof(Key);
+	storage = new Key[std::size_t(p) * stride + padding];
+
+	const std::size_t misalignment = reinterpret_cast< std::size_t >(storage) % ALIGNMENT;
+	keys = storage + (misalignment == 0 ? 0 : (ALIGNMENT - misalignment) / sizeof(Key));
+
+	population.resize(p);
+	for(unsigned i = 0; i < p; ++i) {
+		population[i] = BasicChromosome< Key >(keys + std::size_t(i) * stride, n);
+	}
+}
+
+template< class Key >
+unsigned BasicPopulation< Key >::getN() const {
+	return n;
+}
+
+template< class Key >
+unsigned BasicPopulation< Key >::getP() const {
+	return p;
+}
+
+template< class Key >
+double BasicPopulation< Key >::getBestFitness() const {
+	return getFitness(0);
+}
+
+template< class Key >
+double BasicPopulation< Key >::getFitness(unsigned i) const {
+	#ifdef RANGECHECK
+		if(i >= getP()) { throw std::range_error("Invalid individual identifier."); }
+	#endif
+	if(i >= sorted) { completeSort(); }
+	return fitness[i].first;
+}
+
+template< class Key >
+const BasicChromosome< Key >& BasicPopulation< Key >::getChromosome(unsigned i) const {
+	#ifdef RANGECHECK
+		if(i >= getP()) { throw std::range_error("Invalid individual identifier."); }
+	#endif
+	if(i >= sorted) { completeSort(); }
+
+	return population[ fitness[i].second ];
+}
+
+template< class Key >
+BasicChromosome< Key >& BasicPopulation< Key >::getChromosome(unsigned i) {
+	#ifdef RANGECHECK
+		if(i >= getP()) { throw std::range_error("Invalid individual identifier."); }
+	#endif
+	if(i >= sorted) { completeSort(); }
+
+	return population[ fitness[i].second ];
+}
+
+template< class Key >
+void BasicPopulation< Key >::setFitness(unsigned i, double f) {
+	fitness[i].first = f;
+	fitness[i].second = i;
+}
+
+template< class Key >
+void BasicPopulation< Key >::sortFitness() {
+	sort(fitness.begin(), fitness.end());
+	sorted = p;
+}
+
+template< class Key >
+void BasicPopulation< Key >::sortFitness(unsigned top) {
+	if(top >= p) { sortFitness(); return; }
+
+	// Move the 'top' best entries to the front, then sort just these:
+	std::nth_element(fitness.begin(), fitness.begin() + top, fitness.end());
+	std::sort(fitness.begin(), fitness.begin() + top);
+	sorted = top;
+}
+
+template< class Key >
+void BasicPopulation< Key >::completeSort() const {
+	// Entries past 'sorted' are no better than those before it, so sorting them suffices:
+	std::sort(fitness.begin() + sorted, fitness.end());
+	sorted = p;
+}
+
+template< class Key >
+Key& BasicPopulation< Key >::operator()(unsigned chromosome, unsigned allele) {
+	return population[chromosome].data()[allele];
+}
+
+template< class Key >
+BasicChromosome< Key >& BasicPopulation< Key >::operator()(unsigned chromosome) {
+	return population[chromosome];
+}
+
+template< class Key >
+void BasicPopulation< Key >::swapRows(unsigned i, BasicPopulation& other, unsigned j) {
+	std::swap(population[i], other.population[j]);
+	std::swap(cost[i], other.cost[j]);
+}
+
+// Key types supported by BRKGA (see KeyTraits.h):
+template class BasicPopulation< double >;
+template class BasicPopulation< float >;
+template class BasicPopulation< unsigned int >;
+template class BasicPopulation< unsigned short >;
@@ -0,0 +1,134 @@
+/**
+ * Population.h
+ *
+ * Encapsulates a population of chromosomes represented by random keys. We don't decode
+ * nor deal with random numbers here; instead, we provide private support methods to set the
+ * fitness of a specific chromosome as well as access methods to each allele. Note that the BRKGA
+ * class must have access to such methods, thus begin a friend. In terms of design, this class is
+ * obviously tightly coupled with BRKGA, and was implemented just to remove unnecessary complexity
+ * from the design of BRKGA.
+ *
+ * All p chromosomes live in a single contiguous buffer of keys aligned to ALIGNMENT bytes, one row
+ * of n keys per chromosome. Each row starts at an aligned address (rows are padded to a multiple
+ * of ALIGNMENT bytes), and is accessed through a BasicChromosome view (see Chromosome.h). This
+ * avoids one heap allocation per chromosome and keeps the rows close together in memory when
+ * mating.
+ *
+ * Rows are referred to by their views only, so BRKGA can hand a whole chromosome over to another
+ * population by swapping row views instead of copying keys (see swapRows()). As a consequence, a
+ * row view of one population may point into the storage of the other population of the same
+ * island; BRKGA owns both and releases them together.
+ *
+ * BasicPopulation is parameterized on the type of the random keys (see KeyTraits.h), and is
+ * explicitly instantiated in Population.cpp for double, float, unsigned int and unsigned short.
+ * Population is the usual population of double keys.
+ *
+ * All public methods in this API *require* the fitness array to be sorted, and thus a call to
+ * sortFitness() beforehand. Since this class is tightly coupled with BRKGA, rest assured: 
+ * everything will work just fine with a Population obtained from BRKGA.
+ *
+ * BRKGA only needs the elite set in order at each generation, so it calls sortFitness(pe), which
+ * places the pe best chromosomes first and in order in O(p + pe log pe) time. The remaining
+ * entries are sorted on demand by the public methods, the first time one of them is asked for a
+ * chromosome that is not among the pe best. Hence the public methods do reorder 'fitness' (which
+ * is mutable): do not call them concurrently on the same population.
+ *
+ * Created on : Jun 21, 2010 by rtoso
+ * Last update: Nov 15, 2010 by rtoso
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef POPULATION_H
+#define POPULATION_H
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include "Chromosome.h"
+
+template< class Key >
+class BasicPopulation {
+	template< class Decoder, class RNG, class K >
+	friend class BRKGA;
+
+public:
+	unsigned getN() const;	// Size of each chromosome
+	unsigned getP() const;	// Size of population
+
+	// These methods REQUIRE fitness to be sorted, and thus a call to sortFitness() beforehand
+	// (this is done by BRKGA, so rest assured: everything will work just fine with BRKGA).
+	// Returns the best fitness in this population:
+	double getBestFitness() const;
+	
+	// Returns the fitness of chromosome i \in {0, ..., getP() - 1}
+	double getFitness(unsigned i) const;
+	
+	// Returns (i+1)-th best chromosome, where i = 0 is the best and i = getP() - 1 is the worst:
+	const BasicChromosome< Key >& getChromosome(unsigned i) const;
+
+	static const unsigned ALIGNMENT = 64;	// Alignment (in bytes) of each row of keys
+
+private:
+	BasicPopulation(const BasicPopulation& other);
+	BasicPopulation(unsigned n, unsigned p);
+	~BasicPopulation();
+
+	const unsigned n;		// Number of genes in each chromosome
+	const unsigned p;		// Number of chromosomes
+	const unsigned stride;	// Distance (in keys) between the first keys of consecutive rows
+
+	Key* storage;			// Block returned by new[] (owned)
+	Key* keys;				// First aligned key in 'storage'
+	std::vector< BasicChromosome< Key > > population;		// Row views (see swapRows())
+	mutable std::vector< std::pair< double, unsigned > > fitness;	// Fitness of each chromosome
+	mutable unsigned sorted;	// Number of leading entries of 'fitness' known to be in order
+	std::vector< double > cost;	// Seconds taken to decode each row (predicted, for offspring)
+
+	void sortFitness();									// Sorts 'fitness' by its first parameter
+	void sortFitness(unsigned top);						// Sorts only the 'top' best entries
+	void completeSort() const;							// Sorts whatever sortFitness(top) left
+	void setFitness(unsigned i, double f);				// Sets the fitness of chromosome i
+	BasicChromosome< Key >& getChromosome(unsigned i);	// Returns a chromosome
+
+	Key& operator()(unsigned i, unsigned j);				// Direct access to allele j of chromosome i
+	BasicChromosome< Key >& operator()(unsigned i);		// Direct access to chromosome i
+
+	// Exchanges row i with row j of 'other' without copying any keys:
+	void swapRows(unsigned i, BasicPopulation& other, unsigned j);
+
+	void allocate();	// Allocates 'storage' and sets 'keys' and the row views
+
+	BasicPopulation& operator=(const BasicPopulation& other);	// Not allowed
+};
+
+typedef BasicPopulation< double > Population;
+
+#endif
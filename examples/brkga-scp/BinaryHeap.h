@@ -96,6 +96,11 @@ public:
     bool decreaseKey(const unsigned v, const T& w);
     bool increaseKey(const unsigned v, const T& w);
 
+    /**
+     * \brief Remove all items, keeping the memory allocated for reuse.
+     */
+    void clear();
+
     /**
      * \brief Get the key of an item.
      * \param v Item.
@@ -231,6 +236,16 @@ inline bool BinaryHeap< T >::increaseKey(const unsigned v, const T& w) {
     return true;
 }
 
+template< class T >
+inline void BinaryHeap< T >::clear() {
+	for(unsigned i = 0; i < itemCounter; ++i) {
+		position[heap[i]] = std::numeric_limits< unsigned >::max();
+	}
+
+	heap.clear();
+	itemCounter = 0;
+}
+
 /******************************************************************************
  *                            Getterrs and Setters                            *
  *****************************************************************************/
@@ -68,8 +68,14 @@ SetCoveringDecoder::~SetCoveringDecoder() {
 	for(unsigned i = 0; i < nrows; ++i) { deleteRow(i); }
 }
 
-double SetCoveringDecoder::decode(std::vector< double >& chromosome) const {
-	SetCoveringSolution solution(chromosome, false, false, false, 0.5);
+double SetCoveringDecoder::decode(Chromosome& chromosome) const {
+	Workspace workspace;
+	return decode(chromosome, workspace);
+}
+
+double SetCoveringDecoder::decode(Chromosome& chromosome, Workspace& workspace) const {
+	SetCoveringSolution& solution = workspace.solution;
+	solution.reset(chromosome, false, false, false, 0.5);
 	bool coverChangedSolution = solution.greedyCover();
 	bool uncover1ChangedSolution = solution.greedyUncover();
 	bool oneOPTChangedSolution = solution.oneOPT();
@@ -89,6 +95,14 @@ double SetCoveringDecoder::decode(std::vector< double >& chromosome) const {
 	return solution.getCost();
 }
 
+double SetCoveringDecoder::estimate(const Chromosome& chromosome, Workspace& workspace) const {
+	SetCoveringSolution& solution = workspace.solution;
+	solution.reset(chromosome, false, false, false, 0.5);
+	solution.greedyCover();
+	solution.greedyUncover();
+	return solution.getCost();
+}
+
 bool SetCoveringDecoder::verify(const std::vector< bool >& cover) const {
 	unsigned coveredRows = 0;
 	std::vector< unsigned > rowsCovered(nrows);
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include "Node.h"
 #include "SetCoveringSolution.h"
+#include "brkgaAPI/Chromosome.h"
 
 class SetCoveringDecoder {
 	friend class SetCoveringSolution;
@@ -25,7 +26,21 @@ public:
 	SetCoveringDecoder(const char* filename);
 	~SetCoveringDecoder();
 
-	double decode(std::vector< double >& chromosome) const;
+	// Scratch space of one thread, reused by BRKGA across calls to decode() (construct it only
+	// after the instance has been read):
+	struct Workspace {
+		Workspace() : solution() { }
+		SetCoveringSolution solution;
+	};
+
+	// Decodes a chromosome. The first overload builds a Workspace (sized to the instance) per call,
+	// as the decoder always did; BRKGA only calls the second one, with one workspace per thread:
+	double decode(Chromosome& chromosome) const;
+	double decode(Chromosome& chromosome, Workspace& workspace) const;	// Reuses 'workspace'
+
+	// Cheaper approximation of decode() without 1-OPT, which leaves the chromosome unchanged (see
+	// BRKGA::setScreening()):
+	double estimate(const Chromosome& chromosome, Workspace& workspace) const;
 	bool verify(const std::vector< bool >& cover) const;
 
 	unsigned getNRows() const;
@@ -6,19 +6,47 @@
  */
 
 #include "SetCoveringSolution.h"
+#include "SetCoveringDecoder.h"
 
-SetCoveringSolution::SetCoveringSolution(const std::vector< double >& chromosome,
+SetCoveringSolution::SetCoveringSolution(const Chromosome& chromosome,
 		const bool runCover, const bool runUncover, const bool runOneOPT, const double cutoff) :
 		cost(0.0),
 		coveredRows(0),
 		openedColumns(0),
 		colsCoveringRow(SetCoveringDecoder::nrows, 0),
 		selectedColumns(SetCoveringDecoder::ncolumns, false),
-		rowsCoveredByCol(SetCoveringDecoder::rowsCoveredByColumn) {
+		rowsCoveredByCol(SetCoveringDecoder::rowsCoveredByColumn),
+		heap(SetCoveringDecoder::ncolumns),
+		uncoveredRows() {
+	reset(chromosome, runCover, runUncover, runOneOPT, cutoff);
+}
+
+SetCoveringSolution::SetCoveringSolution() :
+		cost(0.0),
+		coveredRows(0),
+		openedColumns(0),
+		colsCoveringRow(SetCoveringDecoder::nrows, 0),
+		selectedColumns(SetCoveringDecoder::ncolumns, false),
+		rowsCoveredByCol(SetCoveringDecoder::rowsCoveredByColumn),
+		heap(SetCoveringDecoder::ncolumns),
+		uncoveredRows() {
+}
+
+void SetCoveringSolution::reset(const Chromosome& chromosome,
+		const bool runCover, const bool runUncover, const bool runOneOPT, const double cutoff) {
+	// Start from scratch (assign() reuses the memory of each vector):
+	cost = 0.0;
+	coveredRows = 0;
+	openedColumns = 0;
+	colsCoveringRow.assign(SetCoveringDecoder::nrows, 0);
+	selectedColumns.assign(SetCoveringDecoder::ncolumns, false);
+	rowsCoveredByCol.assign(SetCoveringDecoder::rowsCoveredByColumn.begin(),
+			SetCoveringDecoder::rowsCoveredByColumn.end());
+
 	// First, open all columns indicated by the chromosome:
 	for(unsigned j = 0; j < chromosome.size(); ++j) {
 		if(chromosome[j] < cutoff || rowsCoveredByCol[j] == 0) { continue; }
-		openColumn(j, 0);	// Open it
+		openColumn(j);	// Open it
 	}
 
 	if(runCover && isFeasible() == false) { greedyCover(); }
@@ -48,20 +76,20 @@ bool SetCoveringSolution::greedyCover() {
 	if(coveredRows == SetCoveringDecoder::nrows) { return false; }
 
 	// Initialize heap with columnCount values:
-	BinaryHeap< double >* heap = new BinaryHeap< double >(SetCoveringDecoder::ncolumns);
+	heap.clear();
 	for(unsigned j = 0; j < SetCoveringDecoder::ncolumns; ++j) {
 		if(rowsCoveredByCol[j] > 0) {
-			heap->insert(j, - double(rowsCoveredByCol[j] / SetCoveringDecoder::columnCosts[j]));
+			heap.insert(j, - double(rowsCoveredByCol[j] / SetCoveringDecoder::columnCosts[j]));
 		}
 	}
 
 	while(coveredRows < SetCoveringDecoder::nrows) {
-		const unsigned greedyCol = heap->extractMin();	// Get best column from heap
+		const unsigned greedyCol = heap.extractMin();	// Get best column from heap
 
-		openColumn(greedyCol, &heap);	// Open it
+		openColumn(greedyCol, heap);	// Open it
 	}
 
-	delete heap;
+	heap.clear();
 	return isFeasible();
 }
 
@@ -97,7 +125,7 @@ bool SetCoveringSolution::oneOPT() {
 
 		// Column 'columnToLeave' with cost = 'costToLeave', is a candidate for leaving...
 		// We first build a list of the rows affected by the removal of such:
-		std::list< unsigned > uncoveredRows;
+		uncoveredRows.clear();
 		for(Node* ptr = SetCoveringDecoder::columns[columnToLeave]; ptr != 0; ptr = ptr->down) {
 			if(colsCoveringRow[ptr->row] == 1) { uncoveredRows.push_back(ptr->row); }
 		}
@@ -118,7 +146,7 @@ bool SetCoveringSolution::oneOPT() {
 			// Does this column cover the rows left uncovered after the removal of columnToLeave?
 			unsigned willCover = 0;
 			for(Node* ptr = SetCoveringDecoder::columns[columnToEnter]; ptr != 0; ptr = ptr->down) {
-				std::list< unsigned >::iterator pos = std::find(uncoveredRows.begin(),
+				std::vector< unsigned >::iterator pos = std::find(uncoveredRows.begin(),
 						uncoveredRows.end(), ptr->row);
 				if(pos == uncoveredRows.end()) { break; }
 				else { ++willCover; }
@@ -127,7 +155,7 @@ bool SetCoveringSolution::oneOPT() {
 			// If so, exchange and break out of the loop:
 			if(willCover == uncoveredRows.size()) {
 				closeColumn(columnToLeave);
-				openColumn(columnToEnter, 0);
+				openColumn(columnToEnter);
 				improved = true;
 				break;
 			}
@@ -137,7 +165,14 @@ bool SetCoveringSolution::oneOPT() {
 	return improved;
 }
 
-inline void SetCoveringSolution::openColumn(const unsigned column, BinaryHeap< double >** ptrHeap) {
+inline void SetCoveringSolution::openColumn(const unsigned column) { open(column, 0); }
+
+inline void SetCoveringSolution::openColumn(const unsigned column,
+		BinaryHeap< double >& columnHeap) {
+	open(column, &columnHeap);
+}
+
+inline void SetCoveringSolution::open(const unsigned column, BinaryHeap< double >* columnHeap) {
 	// Process current row, being covered by col. 'column':
 	for(Node* ptr = SetCoveringDecoder::columns[column]; ptr != 0; ptr = ptr->down) {
 		// Update 'rowsCoveredByCol' if this row is being covered for the first time:
@@ -150,8 +185,8 @@ inline void SetCoveringSolution::openColumn(const unsigned column, BinaryHeap< d
 			do {
 				--rowsCoveredByCol[curr->column];
 
-				if(ptrHeap != 0) {
-					(*ptrHeap)->increaseKey(curr->column,
+				if(columnHeap != 0) {
+					columnHeap->increaseKey(curr->column,
 							- double(rowsCoveredByCol[curr->column]
 							         / SetCoveringDecoder::columnCosts[curr->column]));
 				}
@@ -8,18 +8,28 @@
 #ifndef SETCOVERINGSOLUTION_H
 #define SETCOVERINGSOLUTION_H
 
-#include <list>
+#include <algorithm>
 #include <vector>
 #include "Node.h"
 #include "BinaryHeap.h"
-#include "SetCoveringDecoder.h"
+#include "brkgaAPI/Chromosome.h"
 
 class SetCoveringSolution {
 public:
-	explicit SetCoveringSolution(const std::vector< double >& chromosome,
+	explicit SetCoveringSolution(const Chromosome& chromosome,
 			const bool runCover, const bool runUncover, const bool runOneOPT, double cutoff);
+
+	// Empty solution (no column opened) to be set with reset(); requires SetCoveringDecoder to
+	// have read the instance already:
+	SetCoveringSolution();
+
 	~SetCoveringSolution();
 
+	// Rebuilds *this from 'chromosome' exactly like the constructor does, but reusing the memory
+	// already allocated (see SetCoveringDecoder::Workspace):
+	void reset(const Chromosome& chromosome,
+			const bool runCover, const bool runUncover, const bool runOneOPT, double cutoff);
+
 	// Greedy heuristic to open extra columns so as to make *this feasible
 	// Returns: true if the solution changed
 	bool greedyCover();
@@ -33,8 +43,9 @@ public:
 	// on top of a feasible solution.
 	bool oneOPT();
 
-	// Algorithm to open a new column while updating internals and the heap, if supplied
-	void openColumn(const unsigned column, BinaryHeap< double >** refHeap);
+	// Algorithm to open a new column while updating internals (and the keys of 'columnHeap'):
+	void openColumn(const unsigned column);
+	void openColumn(const unsigned column, BinaryHeap< double >& columnHeap);
 
 	// Algorihm to close a column:
 	void closeColumn(const unsigned column);
@@ -52,6 +63,8 @@ public:
 	const std::vector< bool >& getSelectedColumns() const;
 
 private:
+	void open(const unsigned column, BinaryHeap< double >* columnHeap);	// Both openColumn()
+
 	// Cost:
 	double cost;
 	// Number of covered rows:
@@ -64,6 +77,10 @@ private:
 	std::vector< bool > selectedColumns;
 	// Number of uncovered rows that'll get covered by each column:
 	std::vector< unsigned > rowsCoveredByCol;
+	// Heap used by greedyCover():
+	BinaryHeap< double > heap;
+	// Rows left uncovered by a column, used by oneOPT():
+	std::vector< unsigned > uncoveredRows;
 };
 
 #endif
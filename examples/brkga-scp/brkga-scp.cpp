@@ -115,8 +115,6 @@ int main(int argc, char* argv[]) {
 				10 * decoder.getNRows(), pe, pm, rhoe, decoder, rng, K, MAXT);
 
 		unsigned long iteration = 0;
-		unsigned long lastUpdate = 0;
-		double bestFitness = std::numeric_limits< double >::max();
 
 		if(verbose) {
 			string mode = "for #generations = ";
@@ -127,13 +125,29 @@ int main(int argc, char* argv[]) {
 					<< mode << stopArg << "..." << endl;
 		}
 
-		bool run = true;
-		while(run) {
-			// Evolution:
-			algorithm.evolve();
+		// The stopping rule maps onto evolve(generations, seconds, target, stall), which is called
+		// once per elite-exchange interval. The stall count only carries over an interval that did
+		// not improve the best fitness, so IMPROVEMENT may run up to X_INTVL generations longer
+		// than a check after every generation would:
+		const unsigned generations = (stopRule == GENERATIONS ? stopArg :
+				std::numeric_limits< unsigned >::max());
+		const double target = (stopRule == TARGET ? double(stopArg) :
+				-std::numeric_limits< double >::infinity());
+		const bool exchange = (K > 1 && X_INTVL > 0);
+		unsigned idle = 0;	// Generations since the best fitness improved (see above)
+		while(iteration < generations) {
+			const unsigned chunk = unsigned(std::min< unsigned long >(
+					exchange ? X_INTVL : generations, generations - iteration));
+			const unsigned stall = (stopRule == IMPROVEMENT ? std::max(stopArg - idle, 1U) : 0);
+			const double before = algorithm.getBestFitness();
+			const unsigned done = algorithm.evolve(chunk, std::numeric_limits< double >::infinity(),
+					target, stall);
+			iteration += done;
+			idle = (algorithm.getBestFitness() < before ? 0 : idle + done);
+			if(done < chunk || (stopRule == IMPROVEMENT && idle >= stopArg)) { break; }
 
 			// Elite-exchange:
-			if(K > 1 && X_INTVL > 0 && iteration > 0 && iteration % X_INTVL == 0) {
+			if(exchange && iteration < generations) {
 				algorithm.exchangeElite(X_NUMBER);
 
 				if(verbose) {
@@ -141,33 +155,11 @@ int main(int argc, char* argv[]) {
 							<< iteration << "; best so far: " << algorithm.getBestFitness() << endl;
 				}
 			}
-
-			// Update runtime data:
-			if(algorithm.getBestFitness() < bestFitness) {
-				bestFitness = algorithm.getBestFitness();
-				lastUpdate = iteration;
-			}
-
-			// Time to stop?
-			switch(stopRule) {
-			case GENERATIONS:
-				if(iteration >= stopArg) { run = false; }
-				break;
-
-			case TARGET:
-				if(bestFitness <= stopArg) { run = false; }
-				break;
-
-			case IMPROVEMENT:
-				if(iteration - lastUpdate >= stopArg) { run = false; }
-				break;
-			}
-
-			++iteration;	// Prepare next iteration
 		}
 
-		std::vector< double > bestChromosome(algorithm.getBestChromosome());
-		SetCoveringSolution best(bestChromosome, true, true, false, 0.5);
+		const double bestFitness = algorithm.getBestFitness();
+
+		SetCoveringSolution best(algorithm.getBestChromosome(), true, true, false, 0.5);
 		if(! decoder.verify(best.getSelectedColumns())) {
 			cerr << "WARNING: Best solution could NOT be verified!" << endl;
 		}
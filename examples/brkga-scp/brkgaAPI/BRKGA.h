@@ -7,8 +7,9 @@
  *
  * - BRKGA() constructor: initializes the populations with parameters described below.
  * - evolve() operator: evolve each Population following the BRKGA methodology. This method
- *                      supports OpenMP to evolve up to K independent Populations in parallel.
- *                      Please note that double Decoder::decode(...) MUST be thread-safe.
+ *                      supports OpenMP to evolve up to K independent Populations in parallel
+ *                      (see setParallelIslands()). Please note that double Decoder::decode(...)
+ *                      MUST be thread-safe.
  *
  * Required parameters:
  * - n: number of genes in each chromosome
@@ -28,17 +29,42 @@
  *     - double rand() to return a double precision random deviate in range [0,1)
  *     - unsigned long randInt() to return a >=32-bit unsigned random deviate in range [0,2^32-1)
  *     - unsigned long randInt(N) to return a unsigned random deviate in range [0, N] with N < 2^32
+ *     Optionally, RNG may also implement the bulk methods fill() and fillUInt32() described in
+ *     BulkRandom.h (MTRand does), which BRKGA then uses to generate keys and crossover words.
+ *     PhiloxRand (see PhiloxRand.h) also meets these requirements; BRKGA uses it internally when
+ *     counter-based random numbers are enabled (see setCounterBasedRandom()).
  *
  * Decoder: problem-specific decoder that implements any of the decode methods outlined below. When
  *          compiling and linking BRKGA with -fopenmp (i.e., with multithreading support via
  *          OpenMP), the method must be thread-safe.
- *     - double decode(const vector< double >& chromosome) const, if you don't want to change
+ *     - double decode(const Chromosome& chromosome) const, if you don't want to change
  *       chromosomes inside the framework, or
- *     - double decode(vector< double >& chromosome) const, if you'd like to update a chromosome.
+ *     - double decode(Chromosome& chromosome) const, if you'd like to update a chromosome.
+ *     Chromosome (see Chromosome.h) is a view over the keys stored contiguously in Population and
+ *     offers size(), operator[] and begin()/end() just like std::vector< double >. When Key is not
+ *     double, decode() takes a BasicChromosome< Key > instead.
+ *     Optionally, Decoder may also implement decodeBatch() as described in BatchDecoder.h, which
+ *     BRKGA then calls with a batch of chromosomes per thread instead of calling decode(). Decoders
+ *     that need scratch buffers may declare a Workspace type, one of which BRKGA keeps per thread
+ *     and passes to decode() as a second argument (see Workspace.h). Decoders that can tell early
+ *     that a chromosome is worse than the elite set may implement a decode() that also takes the
+ *     fitness of the worst elite chromosome and stops there (see BoundedDecoder.h), and decoders
+ *     with a cheap approximation may implement estimate() to screen offspring before decoding
+ *     them (see EstimatingDecoder.h and setScreening()), and decoders that can update the decoded
+ *     state of the elite parent of an offspring may implement decodeDelta() (see DeltaDecoder.h
+ *     and setDeltaDecoding()), and decoders that wait on other processes may implement submit()
+ *     and complete() to keep many evaluations in flight (see AsyncDecoder.h and
+ *     setAsyncDecoding()). Decoders that are expensive and see repeated chromosomes can be put
+ *     behind a fitness cache with setFitnessCache(), and decoders that run for long may poll the
+ *     CancellationToken of an evolution and give up early (see setCancellationToken()).
  *     WARNING: even though both methods use const correctness to enforce that they are thread safe
  *              the use of mutable within the Decoder class could void such a feature! In other
  *              words, DO NOT use mutable within the decoder.
  *
+ * Key: type of the random keys; optional, set to double if not supplied. Use float, unsigned int
+ *      (32-bit fixed point) or unsigned short (16-bit fixed point) keys to reduce the memory used
+ *      by the populations; see KeyTraits.h for details.
+ *
  * Created on : Jun 22, 2010 by rtoso
  * Last update: Sep 15, 2011 by rtoso
  * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
@@ -74,12 +100,32 @@
 #define BRKGA_H
 
 #include <omp.h>
+#include <ctime>
+#include <limits>
+#include <sstream>
 #include <algorithm>
 #include <exception>
 #include <stdexcept>
 #include "Population.h"
+#include "Crossover.h"
+#include "PhiloxRand.h"
+#include "ThreadPool.h"
+#include "Workspace.h"
+#include "BatchDecoder.h"
+#include "BoundedDecoder.h"
+#include "EstimatingDecoder.h"
+#include "DeltaDecoder.h"
+#include "AsyncDecoder.h"
+#include "FitnessCache.h"
+#include "Checkpoint.h"
+#include "Incumbent.h"
+#include "Cancellation.h"
+
+#ifndef _OPENMP
+	#include <sys/time.h>
+#endif
 
-template< class Decoder, class RNG >
+template< class Decoder, class RNG, class Key = double >
 class BRKGA {
 public:
 	/*
@@ -95,7 +141,7 @@ public:
 	 * - K: number of independent Populations
 	 * - MAX_THREADS: number of threads to perform parallel decoding
 	 *                WARNING: Decoder::decode() MUST be thread-safe; safe if implemented as
-	 *                + double Decoder::decode(std::vector< double >& chromosome) const
+	 *                + double Decoder::decode(Chromosome& chromosome) const
 	 */
 	BRKGA(unsigned n, unsigned p, double pe, double pm, double rhoe, const Decoder& refDecoder,
 			RNG& refRNG, unsigned K = 1, unsigned MAX_THREADS = 1) throw(std::range_error);
@@ -110,6 +156,20 @@ public:
 	 */
 	void reset();
 
+	/**
+	 * Warm start: seedPopulation() resets population k like reset() does, but with the given
+	 * chromosomes (e.g., good solutions of a constructive heuristic, encoded as keys) in place
+	 * of the first random ones; all chromosomes are decoded in parallel and ranked.
+	 * injectChromosomes() decodes the given chromosomes in parallel and puts them in place of the
+	 * worst chromosomes of population k, which may happen between any two calls to evolve().
+	 * Both throw std::range_error if k >= K, if there are more than p chromosomes or if one of
+	 * them does not have n keys in [0,1).
+	 */
+	void seedPopulation(const std::vector< std::vector< Key > >& chromosomes, unsigned k = 0)
+			throw(std::range_error);
+	void injectChromosomes(const std::vector< std::vector< Key > >& chromosomes, unsigned k = 0)
+			throw(std::range_error);
+
 	/**
 	 * Evolve the current populations following the guidelines of BRKGAs
 	 * @param generations number of generations (must be even and nonzero)
@@ -118,6 +178,251 @@ public:
 	 */
 	void evolve(unsigned generations = 1);
 
+	/**
+	 * Evolves the current populations for at most 'generations' generations, and returns the
+	 * number of generations completed. It stops early once 'seconds' of wall-clock time have
+	 * passed since the call. It also stops at the end of the first generation after which the
+	 * best fitness is at most 'target' or has not improved for 'stall' generations (0: no limit).
+	 * The deadline is checked before every decode (before every batch, for decoders with
+	 * decodeBatch(), and before every job in steady state), so evolve() overruns it by at most
+	 * one decode (or batch) per thread, or by the evaluations in flight with setAsyncDecoding(). A
+	 * generation cut short is discarded, leaving the population as it was after the previous one,
+	 * except in steady state, where the chromosomes already replaced stay.
+	 */
+	unsigned evolve(unsigned generations, double seconds,
+			double target = -std::numeric_limits< double >::infinity(), unsigned stall = 0);
+
+	/**
+	 * Cooperative cancellation: once 'token' is cancelled (see Cancellation.h), evolve() and the
+	 * background evolution of start() stop handing out decode work and return as soon as the
+	 * decodes under way are over. The generation cut short is discarded, as with the deadline of
+	 * evolve() above, so the populations are left consistent. Values decoded after the
+	 * cancellation are neither kept nor cached, so the decoder may poll the same token and return
+	 * early. The token is only checked within evolve(), so decoders must not return early from
+	 * the decodes of reset(), seedPopulation() and injectChromosomes(). BRKGA does not own the
+	 * token; 0 (the default) disables cancellation.
+	 */
+	void setCancellationToken(const CancellationToken* token);
+	const CancellationToken* getCancellationToken() const;
+
+	/**
+	 * Background execution: start() runs evolve(generations, seconds, target, stall) above on a
+	 * thread of its own and returns at once. stop() cuts the evolution short (as the deadline of
+	 * evolve() does), waits for it to return and returns the number of generations completed; it
+	 * must be called once for every start(), even if isRunning() already tells that the evolution
+	 * is over. In between, other threads may only call getIncumbent(), getIncumbentFitness(),
+	 * isRunning() and stop(). start() throws std::runtime_error if the BRKGA is already started
+	 * or no thread can be created. Without OpenMP, start() runs the evolution itself, so it only
+	 * returns once a stopping rule is met.
+	 */
+	void start(unsigned generations = std::numeric_limits< unsigned >::max(),
+			double seconds = std::numeric_limits< double >::infinity(),
+			double target = -std::numeric_limits< double >::infinity(), unsigned stall = 0)
+			throw(std::runtime_error);
+	unsigned stop();
+	bool isRunning() const;
+
+	/**
+	 * Copies the best chromosome found so far by any population into 'chromosome' (resized to n
+	 * keys) and returns its fitness. It is published at the end of each generation and after
+	 * reset(), seedPopulation() and injectChromosomes(), and may be read by any thread at any time
+	 * without locks, even while the BRKGA runs in the background (see Incumbent.h).
+	 */
+	double getIncumbent(std::vector< Key >& chromosome) const;
+	double getIncumbentFitness() const;
+
+	/**
+	 * Enables (or disables) island parallelism: evolve() then runs the K populations concurrently,
+	 * each one on its own OpenMP thread that mates, sorts and spawns MAX_THREADS threads to decode,
+	 * so up to K * MAX_THREADS threads may be busy at once. Since the islands can no longer share
+	 * refRNG, each island draws from its own RNG, seeded from refRNG when this mode is first
+	 * enabled. Results are reproducible for a given seed, but differ from those of the serial mode.
+	 * Disabled by default.
+	 */
+	void setParallelIslands(bool enable);
+	bool getParallelIslands() const;
+
+	/**
+	 * Enables (or disables) parallel mating: random keys of the initial populations (see reset())
+	 * and the crossover and mutants of each generation are then produced by MAX_THREADS threads.
+	 * The positions to fill are split into MAX_THREADS fixed blocks, and block b of island k always
+	 * draws from the same RNG stream, so results only depend on the seed and on MAX_THREADS (not on
+	 * how threads are scheduled). The K * MAX_THREADS streams are seeded from refRNG when this mode
+	 * is first enabled. Results differ from those of the serial mode. Disabled by default.
+	 */
+	void setParallelMating(bool enable);
+	bool getParallelMating() const;
+
+	/**
+	 * Enables (or disables) vectorized crossover: instead of drawing a double with RNG::rand() for
+	 * each gene and comparing it with rhoe, each offspring draws n 32-bit words in bulk (see
+	 * BulkRandom.h) and inherits gene j from its elite parent iff word j is below a fixed integer
+	 * threshold (see Crossover.h). The alleles are then blended branch-free, with AVX-512 or AVX2
+	 * when compiled for them. Disabled by default, which keeps the original behaviour and random
+	 * sequence.
+	 */
+	void setVectorizedCrossover(bool enable);
+	bool getVectorizedCrossover() const;
+
+	/**
+	 * Enables (or disables) counter-based random numbers: every random decision is then drawn from
+	 * a PhiloxRand stream keyed by (seed, population, generation, chromosome), one for choosing the
+	 * parents and another for the genes, so the randomness used for gene j is a fixed function of
+	 * these and of j (see PhiloxRand.h). Mating and initialization run on MAX_THREADS threads, and
+	 * results are bit-identical for any number of threads, with or without setParallelIslands(),
+	 * as long as decode() is deterministic. The seed is drawn from refRNG when this mode is first
+	 * enabled. Takes precedence over setParallelMating(). Disabled by default.
+	 */
+	void setCounterBasedRandom(bool enable);
+	bool getCounterBasedRandom() const;
+
+	/**
+	 * Enables (or disables) the persistent thread pool: the loops of reset() and evolve() (mating
+	 * and decoding) then run on a ThreadPool of MAX_THREADS threads (see ThreadPool.h) created
+	 * once and reused for every generation, instead of on a new OpenMP team per loop. Decoding is
+	 * balanced dynamically, one chromosome at a time. Each population gets its own pool, so the
+	 * islands can also use their own pools with setParallelIslands(); if 'pinned' is set, the
+	 * workers of population k are pinned to CPUs k * MAX_THREADS + 1, ..., (k + 1) * MAX_THREADS
+	 * - 1. Results are the same as without the pool. Disabled by default.
+	 */
+	void setThreadPool(bool enable, bool pinned = false);
+	bool getThreadPool() const;
+
+	/**
+	 * Statistics of the last decode phase of a population (see setDynamicScheduling()):
+	 */
+	struct DecodeStatistics {
+		DecodeStatistics() : decodes(0), threads(0), wallTime(0.0), busyTime(0.0), meanTime(0.0),
+				maxTime(0.0) { }
+
+		// Fraction of the time threads * wallTime in which threads were not decoding:
+		double getIdleFraction() const {
+			return (wallTime > 0.0 ? 1.0 - busyTime / (threads * wallTime) : 0.0);
+		}
+
+		unsigned decodes;	// number of chromosomes decoded
+		unsigned threads;	// number of threads decoding them
+		double wallTime;	// seconds taken by the whole decode phase
+		double busyTime;	// seconds spent decoding, summed over all chromosomes
+		double meanTime;	// busyTime / decodes
+		double maxTime;		// seconds taken by the slowest chromosome (the worst straggler)
+	};
+
+	/**
+	 * Enables (or disables) dynamic scheduling of decodes: threads then claim 'chunk' chromosomes
+	 * at a time as they become idle (on OpenMP or on the pool of setThreadPool()), and the
+	 * offspring of each generation are decoded in decreasing order of predicted cost, which is the
+	 * mean time taken to decode their two parents (mutants are predicted to take the mean time of
+	 * the previous generation). Long decodes thus start first and do not leave threads idle at the
+	 * end of a generation. Every decode is timed, and getDecodeStatistics() reports the statistics
+	 * of the last decode phase of each population. Has no effect on decoders that implement
+	 * decodeBatch(). Results are the same. Disabled by default (static scheduling).
+	 */
+	void setDynamicScheduling(bool enable, unsigned chunk = 1);
+	bool getDynamicScheduling() const;
+	const DecodeStatistics& getDecodeStatistics(unsigned k = 0) const;
+
+	/**
+	 * Enables (or disables) the fitness cache: a FitnessCache of 'capacity' entries (see
+	 * FitnessCache.h), shared by all populations, is looked up before decoding each chromosome,
+	 * and chromosomes found there get the cached fitness without being decoded. Every decoded
+	 * chromosome is cached under its keys before decode() and, if decode() changed them, also
+	 * under its keys after decode(), which is the chromosome that stays in the population with the
+	 * returned fitness; a chromosome found in the cache is left unchanged. Pays off when decode()
+	 * costs much more than hashing n keys and chromosomes repeat (e.g., offspring of two equal
+	 * parents, or decoders that map many chromosomes onto few solutions and write them back).
+	 * Requires decode() to be deterministic. Enabling it again empties the cache. Disabled by
+	 * default.
+	 */
+	void setFitnessCache(bool enable, unsigned capacity = 65536);
+	bool getFitnessCache() const;
+	unsigned long getCacheHits() const;		// chromosomes found in the cache so far
+	unsigned long getCacheMisses() const;	// chromosomes looked up and decoded so far
+
+	/**
+	 * Enables (or disables) screening, for decoders that implement estimate() (see
+	 * EstimatingDecoder.h): evolve() then estimates every offspring and mutant, and decodes only
+	 * the best estimated 'fraction' of them (at least one). The others keep their estimates, raised
+	 * to the fitness of the worst elite chromosome if below it, so that the elite set only ever
+	 * holds decoded chromosomes and ranks them by decode(). reset() still decodes every chromosome.
+	 * Has no effect on decoders without estimate(). Disabled by default.
+	 */
+	void setScreening(bool enable, double fraction = 0.25);
+	bool getScreening() const;
+	double getScreeningFraction() const;	// fraction of the estimated chromosomes decoded
+
+	/**
+	 * Enables (or disables) delta decoding, for decoders that implement decodeDelta() (see
+	 * DeltaDecoder.h): BRKGA then keeps the State of every chromosome, records the genes in which
+	 * each offspring differs from its elite parent, and passes both to decodeDelta(), which only
+	 * has to rebuild what these genes change. Chromosomes with no known parent state (mutants,
+	 * new populations, chromosomes found in the fitness cache or received from exchangeElite())
+	 * are decoded from scratch. Takes precedence over the bounded decode() and decodeBatch().
+	 * Results are the same. Has no effect on decoders without decodeDelta(). Disabled by default.
+	 */
+	void setDeltaDecoding(bool enable);
+	bool getDeltaDecoding() const;
+
+	/**
+	 * Enables (or disables) speculative mutants: since mutants do not depend on the ranking of the
+	 * population, evolve() generates and decodes the pm mutants of the next generation of each
+	 * population while it breeds the offspring of the current one, on the threads left idle by
+	 * mating, and then hands them over by swapping rows. Mutants are decoded in full (with no
+	 * elite set to compare against yet). With counter-based random numbers the keys are the same
+	 * as without speculation, and so are the results unless the decoder stops early (see
+	 * BoundedDecoder.h); otherwise the mutant keys are drawn from the same generator before the
+	 * offspring instead of after them. Disabled by default.
+	 */
+	void setSpeculativeMutants(bool enable);
+	bool getSpeculativeMutants() const;
+
+	/**
+	 * Enables (or disables) steady-state evolution: evolve(g) then runs g * (p - pe) jobs per
+	 * population with no barrier between generations. Each thread repeatedly breeds one offspring
+	 * (or a mutant, pm of every p - pe jobs) from the population as it stands, decodes it, and
+	 * inserts it into the ranked population in place of its oldest non-elite chromosome; since a
+	 * generation replaces exactly the non-elite chromosomes, the elite set is kept as in BRKGA,
+	 * but a job sees the results of the jobs completed before it. Threads only wait for each other
+	 * while breeding and inserting, so they stay busy when decoding times vary. Populations are
+	 * fully sorted afterwards. Results depend on the timing of the threads. Jobs draw from refRNG
+	 * (or from the RNG of the island), are decoded one at a time by decode() (bounded by the worst
+	 * elite chromosome at breeding time, and through the fitness cache), and are not affected by
+	 * setParallelMating(), setCounterBasedRandom(), setScreening(), setDeltaDecoding() or
+	 * setSpeculativeMutants(). Disabled by default.
+	 */
+	void setSteadyState(bool enable);
+	bool getSteadyState() const;
+
+	/**
+	 * Enables (or disables) asynchronous decoding, for decoders that implement submit() and
+	 * complete() (see AsyncDecoder.h): evolve() and reset() then decode each population from one
+	 * thread, which keeps up to 'inFlight' evaluations in flight (regardless of MAX_THREADS),
+	 * submitting a chromosome as soon as another one completes. The fitness cache and screening
+	 * still apply; delta decoding and decodeBatch() do not, and neither does the bounded decode(),
+	 * so results are exact. Steady-state evolution and speculative mutants still call decode().
+	 * Has no effect on decoders without submit() and complete(). Disabled by default.
+	 */
+	void setAsyncDecoding(bool enable, unsigned inFlight = 64);
+	bool getAsyncDecoding() const;
+	unsigned getInFlight() const;	// maximum number of evaluations in flight
+
+	/**
+	 * Writes a checkpoint of the whole state of the algorithm to 'out' in a single write: the
+	 * current and previous populations with their fitness, the state of refRNG and of the other
+	 * generators, the options set above and the generation counters, and the contents of the
+	 * fitness cache, the spare mutants and the steady-state bookkeeping (see Checkpoint.h for the
+	 * format). readCheckpoint() restores it into a BRKGA built with the same n, p, pe, pm, rhoe,
+	 * K, MAX_THREADS and Key (e.g., in a new process after the first one was stopped), overwriting
+	 * the state of refRNG too, after which evolve() continues as it would have from the point
+	 * the checkpoint was written. The States of delta decoding are not saved; chromosomes are
+	 * decoded from scratch until they are rebuilt, with the same results. RNG must implement
+	 * operator<< and operator>> (MTRand does). readCheckpoint() throws std::runtime_error, and
+	 * changes nothing, if the checkpoint is damaged or was written by another version of the
+	 * format, another type of machine or a BRKGA with other parameters.
+	 */
+	void writeCheckpoint(std::ostream& out) const throw(std::runtime_error);
+	void readCheckpoint(std::istream& in) throw(std::runtime_error);
+
 	/**
 	 * Exchange elite-solutions between the populations
 	 * @param M number of elite chromosomes to select from each population
@@ -127,12 +432,12 @@ public:
 	/**
 	 * Returns the current population
 	 */
-	const Population& getPopulation(unsigned k = 0) const;
+	const BasicPopulation< Key >& getPopulation(unsigned k = 0) const;
 
 	/**
 	 * Returns the chromosome with best fitness so far among all populations
 	 */
-	const std::vector< double >& getBestChromosome() const;
+	const BasicChromosome< Key >& getBestChromosome() const;
 
 	/**
 	 * Returns the best fitness found so far among all populations
@@ -157,6 +462,7 @@ private:
 	const unsigned pe;	// number of elite items in the population
 	const unsigned pm;	// number of mutants introduced at each generation into the population
 	const double rhoe;	// probability that an offspring inherits the allele of its elite parent
+	const unsigned crossoverThreshold;	// rhoe as a 32-bit threshold (see Crossover.h)
 
 	// Templates:
 	RNG& refRNG;				// reference to the random number generator
@@ -165,22 +471,286 @@ private:
 	// Parallel populations parameters:
 	const unsigned K;				// number of independent parallel populations
 	const unsigned MAX_THREADS;		// number of threads for parallel decoding
+	bool parallelIslands;			// evolve the K populations concurrently?
+	std::vector< RNG* > islandRNG;	// one RNG per population, used when parallelIslands is set
+	bool parallelMating;			// generate keys and offspring with MAX_THREADS threads?
+	std::vector< RNG* > streams;	// MAX_THREADS RNGs per population, used by parallelMating
+	bool vectorizedCrossover;		// mate with bulk random words and the kernels of Crossover.h?
+	bool counterBased;				// draw from PhiloxRand streams keyed by position?
+	unsigned long counterSeed;		// seed of the PhiloxRand streams
+	std::vector< unsigned long > epoch;	// number of generations (or resets) of each population
+	bool threadPool;				// run the parallel loops on 'pools'?
+	std::vector< ThreadPool* > pools;	// one pool of MAX_THREADS threads per population
+	unsigned dynamicChunk;			// chunk size of dynamic scheduling (0: static scheduling)
+	std::vector< std::vector< unsigned > > order;	// order of the decodes of each population
+	std::vector< DecodeStatistics > statistics;		// last decode phase of each population
+	FitnessCache* cache;			// looked up before decoding (0: no cache)
+	double screening;				// fraction of offspring decoded after estimate() (0: all)
+	unsigned inFlight;				// evaluations in flight with submit() (0: synchronous)
+	double deadline;				// now() at which evolve() stops (infinity: no deadline)
+	volatile int stopped;			// has the deadline passed (or the evolution been cancelled)?
+	const CancellationToken* token;	// checked within evolve(), if set
+	bool evolving;					// within evolve()? (only then is it cut short)
+
+	// Background execution (see start()):
+	Incumbent< Key > incumbent;		// best chromosome found so far
+	struct Background {				// arguments and result of evolve() on the background thread
+		BRKGA* brkga;
+		unsigned generations;
+		double seconds, target;
+		unsigned stall;
+		unsigned done;				// generations completed
+		#ifdef _OPENMP
+			pthread_t handle;
+		#endif
+	};
+
+	Background* background;			// 0 unless started
+	volatile int halted;			// set by stop()
+	volatile int running;			// is evolve() running on the background thread?
+
+	// Delta decoding (see DeltaDecoder.h):
+	typedef typename DeltaTraits< Decoder >::State State;
+	struct Deltas {		// States of population k and of its previous generation
+		explicit Deltas(unsigned p) : states(2 * p), valid(2 * p, 0), current(p), previous(p),
+				parent(p, p), genes(p) {
+			for(unsigned i = 0; i < p; ++i) { current[i] = i; previous[i] = p + i; }
+		}
+
+		std::vector< State > states;	// 2p states, one per row of current[k] and previous[k]
+		std::vector< char > valid;		// does states[s] describe the keys of its row?
+		std::vector< unsigned > current;	// state of each row of current[k]
+		std::vector< unsigned > previous;	// state of each row of previous[k]
+		std::vector< unsigned > parent;		// row of the elite parent of offspring (p: none)
+		std::vector< std::vector< unsigned > > genes;	// genes in which it differs from parent
+	};
+
+	std::vector< Deltas* > deltas;	// one per population if delta decoding is enabled
+
+	// Speculative mutants, pm rows per population if enabled (and pm > 0):
+	std::vector< BasicPopulation< Key >* > spares;	// mutants of the next generation
+	std::vector< char > ready;		// have the spares of population k been decoded?
+
+	// Steady-state evolution, if enabled:
+	struct SteadyState {	// Shared by the threads evolving population k
+		explicit SteadyState(unsigned p) : flag(0), born(p, 0), clock(0), jobs(0) { }
+
+		void lock() { while(__sync_lock_test_and_set(&flag, 1)) { while(flag) { } } }
+		void unlock() { __sync_lock_release(&flag); }
+
+		volatile int flag;		// Spinlock protecting current[k] and the members below
+		std::vector< unsigned long > born;	// time at which each row was inserted
+		unsigned long clock;	// number of insertions so far
+		unsigned long jobs;		// number of jobs started so far
+	};
+
+	std::vector< SteadyState* > steady;	// one per population
+	std::vector< BasicPopulation< Key >* > children;	// one row per thread of each population
 
 	// Data:
-	std::vector< Population* > previous;	// previous populations
-	std::vector< Population* > current;		// current populations
+	std::vector< BasicPopulation< Key >* > previous;	// previous populations
+	std::vector< BasicPopulation< Key >* > current;		// current populations
+
+	// Decoder workspaces, MAX_THREADS per population (see Workspace.h):
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+	std::vector< Workspace* > workspaces;	// workspace of thread t of population k: k * T + t
+
+	// Buffers of the batch path of decode(), reused like the workspaces (same indices):
+	struct Scratch {
+		Scratch() : fitness(), misses(), hashes(), views() { }
+		std::vector< double > fitness;					// Fitness of the batch
+		std::vector< unsigned > misses;					// Rows missing from the cache
+		std::vector< FitnessCache::Hash > hashes;		// Their hashes
+		std::vector< BasicChromosome< Key > > views;	// Their views
+	};
+
+	std::vector< Scratch* > scratch;
 
 	// Local operations:
-	void initialize(const unsigned i);		// initialize current population 'i' with random keys
-	void evolution(Population& curr, Population& next);
-	bool isRepeated(const std::vector< double >& chrA, const std::vector< double >& chrB) const;
+	// Initializes current population 'i' with the 'seeds' (if any) and then random keys:
+	void initialize(const unsigned i, const std::vector< std::vector< Key > >* seeds = 0);
+	void checkSeeds(const std::vector< std::vector< Key > >& chromosomes, const unsigned k) const
+			throw(std::range_error);
+	void decodeRows(BasicPopulation< Key >& population, const unsigned k, const unsigned* rows,
+			const unsigned count);	// Decodes rows[0], ..., rows[count - 1] from scratch
+	bool evolveAll(const unsigned generations);	// false if cut short by the deadline
+	bool evolveIsland(const unsigned k, const unsigned generations);	// likewise
+	bool evolution(BasicPopulation< Key >& curr, BasicPopulation< Key >& next, const unsigned k);
+	void fill(const unsigned k, const unsigned b, const unsigned blocks,
+			const unsigned long generation);	// block b of the rows of current population k
+	void breed(BasicPopulation< Key >& curr, BasicPopulation< Key >& next, const unsigned k,
+			const unsigned b, const unsigned blocks, const unsigned long generation,
+			const unsigned end);	// block b of the offspring and mutants pe, ..., end - 1 of next
+	void speculate(const unsigned k, const unsigned s, const unsigned long generation,
+			Workspace& workspace);	// spare mutant s of population k for 'generation'
+	void takeSpares(BasicPopulation< Key >& next, const unsigned k);	// as mutants of next
+	bool steadyState(const unsigned k, const unsigned generations);	// evolves population k
+	void steadyJob(const unsigned k, const unsigned long job,
+			const unsigned t);	// breeds, decodes and inserts one chromosome with thread t
+	// Decoding, where decoders that stop early may do so above 'cutoff' (see BoundedDecoder.h):
+	void evaluate(BasicPopulation< Key >& population, const unsigned k, const unsigned first,
+			const unsigned last, const double cutoff);	// chromosomes first, ..., last - 1 of k
+	void decode(BasicPopulation< Key >& population, const unsigned k, const unsigned first,
+			const unsigned last, const double cutoff, Workspace& workspace,
+			Scratch& buffers);	// chromosomes first, ..., last - 1 of population k
+	void decode(BasicPopulation< Key >& population, const unsigned k, const unsigned i,
+			const double cutoff, Workspace& workspace);	// chromosome i of population k, timed
+	double fitnessOf(BasicPopulation< Key >& population, const unsigned k, const unsigned i,
+			const double cutoff, Workspace& workspace);	// through the cache and decodeDelta()
+	void decodeAsync(BasicPopulation< Key >& population, const unsigned k, const unsigned* rows,
+			const unsigned count);	// chromosomes rows[0], ..., rows[count - 1] with submit()
+	void remember(const BasicChromosome< Key >& chromosome, const FitnessCache::Hash& hash,
+			double fitness, bool bound);	// caches a chromosome decoded from 'hash'
+	unsigned stateOf(const BasicPopulation< Key >& population, const unsigned k,
+			const unsigned i) const;	// index of the State of row i in deltas[k]->states
+	void record(BasicPopulation< Key >& next, const unsigned k, const unsigned i,
+			const unsigned parent);		// genes in which offspring i differs from its parent
+	static double now();			// wall-clock time in seconds
+	bool expired();					// should evolve() stop? (if so, sets 'stopped')
+	bool cancelled() const;			// has the token been cancelled?
+	static void* runBackground(void* background);	// entry point of the background thread
+	void publish(const unsigned k);	// offers the best chromosome of population k as incumbent
+	template< class ParentRNG, class GeneRNG >	// Offspring or mutant i of next; returns the row
+	unsigned breed(BasicPopulation< Key >& curr, BasicPopulation< Key >& next, const unsigned i,
+			ParentRNG& parentRNG, GeneRNG& geneRNG,
+			std::vector< unsigned >& words);	// of its elite parent in next (p: mutant)
+	bool isRepeated(const BasicChromosome< Key >& chrA, const BasicChromosome< Key >& chrB) const;
+
+	// Checkpoints (see writeCheckpoint()):
+	void writePopulation(CheckpointWriter& out, const BasicPopulation< Key >& population) const;
+	void readPopulation(CheckpointReader& in, BasicPopulation< Key >& population);
+	static void writeRNG(CheckpointWriter& out, const RNG& rng);
+	static void readRNG(CheckpointReader& in, RNG& rng);
+
+	// Runs task(i, t), i = 0, ..., count - 1, on the pool of population k or on an OpenMP team,
+	// where t < max(1, MAX_THREADS) identifies the thread; chunk > 0 schedules dynamically:
+	template< class Task >
+	void parallelFor(const unsigned k, const unsigned count, const Task& task, bool parallel,
+			const unsigned chunk = 0);
+
+	// Tasks of parallelFor():
+	struct FillTask {
+		BRKGA* brkga;
+		unsigned k, blocks;
+		unsigned long generation;
+		void operator()(unsigned b, unsigned) const { brkga->fill(k, b, blocks, generation); }
+	};
+
+	struct BreedTask {
+		BRKGA* brkga;
+		BasicPopulation< Key >* curr;
+		BasicPopulation< Key >* next;
+		unsigned k, blocks;
+		unsigned long generation;
+		unsigned end;		// Rows pe, ..., end - 1 are bred
+		void operator()(unsigned b, unsigned) const {
+			brkga->breed(*curr, *next, k, b, blocks, generation, end);
+		}
+	};
+
+	// Each thread claims jobs until none is left or evolve() is cut short:
+	struct SteadyTask {
+		BRKGA* brkga;
+		unsigned k;
+		unsigned long* next;	// Next job to claim (atomically)
+		unsigned long last;		// Jobs *next, ..., last - 1 are left
+		void operator()(unsigned, unsigned t) const {
+			while(!brkga->expired()) {
+				const unsigned long job = __sync_fetch_and_add(next, 1UL);
+				if(job >= last) { return; }
+
+				brkga->steadyJob(k, job, t);
+			}
+		}
+	};
+
+	// Breeds block i of 'breed' if i < breed->blocks, and decodes spare mutant i - breed->blocks
+	// otherwise:
+	struct SpeculateTask {
+		BRKGA* brkga;
+		const BreedTask* breed;
+		unsigned long generation;	// Generation of the spare mutants
+		void operator()(unsigned i, unsigned t) const {
+			if(i < breed->blocks) { (*breed)(i, t); return; }
+			if(brkga->expired()) { return; }
+
+			const unsigned threads = unsigned(brkga->workspaces.size() / brkga->K);
+			brkga->speculate(breed->k, i - breed->blocks, generation,
+					*brkga->workspaces[breed->k * threads + t]);
+		}
+	};
+
+	struct DecodeTask {
+		BRKGA* brkga;
+		BasicPopulation< Key >* population;
+		unsigned k;
+		unsigned first, count, batches;	// Chromosomes first, ..., first + count - 1 in batches
+		const unsigned* order;			// If set, task(i) decodes chromosome order[i] instead
+		double cutoff;					// Fitness of the worst elite chromosome
+		void operator()(unsigned b, unsigned t) const {
+			const unsigned threads = unsigned(brkga->workspaces.size() / brkga->K);
+			Workspace& workspace = *brkga->workspaces[k * threads + t];
+			if(order != 0) {
+				if(brkga->expired()) { return; }
+
+				brkga->decode(*population, k, order[b], cutoff, workspace);
+				return;
+			}
+
+			brkga->decode(*population, k, first + unsigned((std::size_t(count) * b) / batches),
+					first + unsigned((std::size_t(count) * (b + 1)) / batches), cutoff,
+					workspace, *brkga->scratch[k * threads + t]);
+		}
+	};
+
+	// Predicts the cost of chromosomes with EstimatingDecoder (see EstimatingDecoder.h):
+	struct EstimateTask {
+		BRKGA* brkga;
+		BasicPopulation< Key >* population;
+		unsigned k, first;		// task(i) estimates chromosome first + i
+		void operator()(unsigned i, unsigned t) const {
+			const unsigned threads = unsigned(brkga->workspaces.size() / brkga->K);
+			population->setFitness(first + i, EstimatingDecoder< Decoder, Key >::estimate(
+					brkga->refDecoder, population->population[first + i],
+					*brkga->workspaces[k * threads + t]));
+		}
+	};
+
+	// Orders chromosomes by increasing fitness (or estimate):
+	struct FitnessOrder {
+		const std::vector< std::pair< double, unsigned > >* fitness;
+		bool operator()(unsigned i, unsigned j) const { return (*fitness)[i] < (*fitness)[j]; }
+	};
+
+	// Orders chromosomes by decreasing predicted cost (ties by index):
+	struct CostOrder {
+		const std::vector< double >* cost;
+		bool operator()(unsigned i, unsigned j) const {
+			return ((*cost)[i] > (*cost)[j] || ((*cost)[i] == (*cost)[j] && i < j));
+		}
+	};
+
+	// Number of batches in which to decode 'count' chromosomes (one per chromosome unless the
+	// Decoder implements decodeBatch()):
+	unsigned getBatches(const unsigned count) const;
+
+	BRKGA(const BRKGA&);				// Not allowed
+	BRKGA& operator=(const BRKGA&);		// Not allowed
 };
 
-template< class Decoder, class RNG >
-BRKGA< Decoder, RNG >::BRKGA(unsigned _n, unsigned _p, double _pe, double _pm, double _rhoe,
+template< class Decoder, class RNG, class Key >
+BRKGA< Decoder, RNG, Key >::BRKGA(unsigned _n, unsigned _p, double _pe, double _pm, double _rhoe,
 		const Decoder& decoder, RNG& rng, unsigned _K, unsigned MAX) throw(std::range_error) :
-		n(_n), p(_p), pe(unsigned(_pe * p)), pm(unsigned(_pm * p)), rhoe(_rhoe), refRNG(rng),
-		refDecoder(decoder), K(_K), MAX_THREADS(MAX), previous(K, 0), current(K, 0) {
+		n(_n), p(_p), pe(unsigned(_pe * p)), pm(unsigned(_pm * p)), rhoe(_rhoe),
+		crossoverThreshold(rhoeThreshold(_rhoe)), refRNG(rng),
+		refDecoder(decoder), K(_K), MAX_THREADS(MAX), parallelIslands(false), islandRNG(),
+		parallelMating(false), streams(), vectorizedCrossover(false), counterBased(false),
+		counterSeed(0), epoch(K, 0), threadPool(false), pools(), dynamicChunk(0), order(K),
+		statistics(K), cache(0), screening(0.0), inFlight(0),
+		deadline(std::numeric_limits< double >::infinity()), stopped(0), token(0),
+		evolving(false), incumbent(n),
+		background(0), halted(0), running(0), deltas(), spares(), ready(K, 0), steady(),
+		children(), previous(K, 0), current(K, 0), workspaces(), scratch() {
 	// Error check:
 	using std::range_error;
 	if(n == 0) { throw range_error("Chromosome size equals zero."); }
@@ -191,34 +761,50 @@ BRKGA< Decoder, RNG >::BRKGA(unsigned _n, unsigned _p, double _pe, double _pm, d
 	if(pe + pm > p) { throw range_error("elite + mutant sets greater than population size (p)."); }
 	if(K == 0) { throw range_error("Number of parallel populations cannot be zero."); }
 
+	// One workspace (and batch buffers) per population and thread:
+	const unsigned T = (MAX_THREADS > 1 ? MAX_THREADS : 1);
+	for(unsigned i = 0; i < K * T; ++i) {
+		workspaces.push_back(new Workspace());
+		scratch.push_back(new Scratch());
+	}
+
 	// Initialize and decode each chromosome of the current population, then copy to previous:
 	for(unsigned i = 0; i < K; ++i) {
 		// Allocate:
-		current[i] = new Population(n, p);
+		current[i] = new BasicPopulation< Key >(n, p);
 
 		// Initialize:
 		initialize(i);
 
 		// Then just copy to previous:
-		previous[i] = new Population(*current[i]);
+		previous[i] = new BasicPopulation< Key >(*current[i]);
 	}
 }
 
-template< class Decoder, class RNG >
-BRKGA< Decoder, RNG >::~BRKGA() {
+template< class Decoder, class RNG, class Key >
+BRKGA< Decoder, RNG, Key >::~BRKGA() {
+	stop();
 	for(unsigned i = 0; i < K; ++i) { delete current[i]; delete previous[i]; }
+	for(unsigned i = 0; i < islandRNG.size(); ++i) { delete islandRNG[i]; }
+	for(unsigned i = 0; i < streams.size(); ++i) { delete streams[i]; }
+	for(unsigned i = 0; i < pools.size(); ++i) { delete pools[i]; }
+	for(unsigned i = 0; i < workspaces.size(); ++i) { delete workspaces[i]; delete scratch[i]; }
+	delete cache;
+	for(unsigned i = 0; i < deltas.size(); ++i) { delete deltas[i]; }
+	for(unsigned i = 0; i < spares.size(); ++i) { delete spares[i]; }
+	for(unsigned i = 0; i < steady.size(); ++i) { delete steady[i]; delete children[i]; }
 }
 
-template< class Decoder, class RNG >
-const Population& BRKGA< Decoder, RNG >::getPopulation(unsigned k) const {
+template< class Decoder, class RNG, class Key >
+const BasicPopulation< Key >& BRKGA< Decoder, RNG, Key >::getPopulation(unsigned k) const {
 	#ifdef RANGECHECK
 		if(k >= K) { throw std::range_error("Invalid population identifier."); }
 	#endif
 	return (*current[k]);
 }
 
-template< class Decoder, class RNG >
-double BRKGA< Decoder, RNG >::getBestFitness() const {
+template< class Decoder, class RNG, class Key >
+double BRKGA< Decoder, RNG, Key >::getBestFitness() const {
 	double best = current[0]->fitness[0].first;
 	for(unsigned i = 1; i < K; ++i) {
 		if(current[i]->fitness[0].first < best) { best = current[i]->fitness[0].first; }
@@ -227,8 +813,8 @@ double BRKGA< Decoder, RNG >::getBestFitness() const {
 	return best;
 }
 
-template< class Decoder, class RNG >
-const std::vector< double >& BRKGA< Decoder, RNG >::getBestChromosome() const {
+template< class Decoder, class RNG, class Key >
+const BasicChromosome< Key >& BRKGA< Decoder, RNG, Key >::getBestChromosome() const {
 	unsigned bestK = 0;
 	for(unsigned i = 1; i < K; ++i) {
 		if( current[i]->getBestFitness() < current[bestK]->getBestFitness() ) { bestK = i; }
@@ -237,31 +823,505 @@ const std::vector< double >& BRKGA< Decoder, RNG >::getBestChromosome() const {
 	return current[bestK]->getChromosome(0);	// The top one :-)
 }
 
-template< class Decoder, class RNG >
-void BRKGA< Decoder, RNG >::reset() {
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::reset() {
 	for(unsigned i = 0; i < K; ++i) { initialize(i); }
 }
 
-template< class Decoder, class RNG >
-void BRKGA< Decoder, RNG >::evolve(unsigned generations) {
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::seedPopulation(
+		const std::vector< std::vector< Key > >& chromosomes, unsigned k) throw(std::range_error) {
+	checkSeeds(chromosomes, k);
+	initialize(k, &chromosomes);
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::injectChromosomes(
+		const std::vector< std::vector< Key > >& chromosomes, unsigned k) throw(std::range_error) {
+	checkSeeds(chromosomes, k);
+	const unsigned m = unsigned(chromosomes.size());
+	if(m == 0) { return; }
+
+	// Put the fitness back in row order (as decode() expects), taking the m worst rows:
+	BasicPopulation< Key >& population = *current[k];
+	population.completeSort();
+	std::vector< double > values(p);
+	std::vector< unsigned > rows(m);
+	for(unsigned r = 0; r < p; ++r) {
+		values[population.fitness[r].second] = population.fitness[r].first;
+	}
+
+	for(unsigned j = 0; j < m; ++j) { rows[j] = population.fitness[p - m + j].second; }
+	for(unsigned i = 0; i < p; ++i) { population.setFitness(i, values[i]); }
+
+	for(unsigned j = 0; j < m; ++j) {
+		std::copy(chromosomes[j].begin(), chromosomes[j].end(), population(rows[j]).data());
+		population.cost[rows[j]] = statistics[k].meanTime;
+		if(!deltas.empty()) { record(population, k, rows[j], p); }	// No parent state
+		if(!steady.empty()) { steady[k]->born[rows[j]] = ++steady[k]->clock; }
+	}
+
+	decodeRows(population, k, &rows[0], m);
+	population.sortFitness();
+	publish(k);
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::evolve(unsigned generations) {
 	#ifdef RANGECHECK
 		if(generations == 0) { throw std::range_error("Cannot evolve for 0 generations."); }
 	#endif
 
-	for(unsigned i = 0; i < generations; ++i) {
-		for(unsigned j = 0; j < K; ++j) {
-			evolution(*current[j], *previous[j]);	// First evolve the population (curr, next)
-			std::swap(current[j], previous[j]);		// Update (prev = curr; curr = prev == next)
+	evolving = true;
+	evolveAll(generations);
+	evolving = false;
+	stopped = 0;
+}
+
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::evolve(unsigned generations, double seconds, double target,
+		unsigned stall) {
+	deadline = now() + seconds;
+	stopped = 0;
+	evolving = true;
+
+	double best = getBestFitness();
+	unsigned done = 0;	// Generations completed
+	unsigned idle = 0;	// Generations completed since the best fitness improved
+	while(done < generations && best > target && (stall == 0 || idle < stall)) {
+		if(!evolveAll(1)) { break; }
+
+		++done;
+		const double fitness = getBestFitness();
+		if(fitness < best) { best = fitness; idle = 0; }
+		else { ++idle; }
+	}
+
+	deadline = std::numeric_limits< double >::infinity();
+	evolving = false;
+	stopped = 0;
+	return done;
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setCancellationToken(const CancellationToken* _token) {
+	token = _token;
+}
+
+template< class Decoder, class RNG, class Key >
+const CancellationToken* BRKGA< Decoder, RNG, Key >::getCancellationToken() const {
+	return token;
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::start(unsigned generations, double seconds, double target,
+		unsigned stall) throw(std::runtime_error) {
+	if(background != 0) { throw std::runtime_error("BRKGA already started."); }
+
+	background = new Background();
+	background->brkga = this;
+	background->generations = generations;
+	background->seconds = seconds;
+	background->target = target;
+	background->stall = stall;
+	background->done = 0;
+	halted = 0;
+	running = 1;
+
+	#ifdef _OPENMP
+		if(pthread_create(&background->handle, 0, &BRKGA::runBackground, background) != 0) {
+			delete background;
+			background = 0;
+			running = 0;
+			throw std::runtime_error("Cannot create the background thread.");
 		}
+	#else
+		runBackground(background);
+	#endif
+}
+
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::stop() {
+	if(background == 0) { return 0; }
+
+	halted = 1;
+	#ifdef _OPENMP
+		pthread_join(background->handle, 0);
+	#endif
+
+	const unsigned done = background->done;
+	delete background;
+	background = 0;
+	halted = 0;
+	return done;
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::isRunning() const { return running != 0; }
+
+template< class Decoder, class RNG, class Key >
+double BRKGA< Decoder, RNG, Key >::getIncumbent(std::vector< Key >& chromosome) const {
+	chromosome.resize(n);
+	return incumbent.read(&chromosome[0]);
+}
+
+template< class Decoder, class RNG, class Key >
+double BRKGA< Decoder, RNG, Key >::getIncumbentFitness() const {
+	return incumbent.getFitness();
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setParallelIslands(bool enable) {
+	// Seed one RNG per island from refRNG the first time this mode is enabled:
+	if(enable && islandRNG.empty()) {
+		for(unsigned i = 0; i < K; ++i) { islandRNG.push_back(new RNG(refRNG.randInt())); }
+	}
+
+	parallelIslands = enable;
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getParallelIslands() const { return parallelIslands; }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setParallelMating(bool enable) {
+	// Seed MAX_THREADS streams per island from refRNG the first time this mode is enabled:
+	if(enable && streams.empty()) {
+		const unsigned blocks = (MAX_THREADS > 0 ? MAX_THREADS : 1);
+		for(unsigned i = 0; i < K * blocks; ++i) { streams.push_back(new RNG(refRNG.randInt())); }
 	}
+
+	parallelMating = enable;
 }
 
-template< class Decoder, class RNG >
-void BRKGA< Decoder, RNG >::exchangeElite(unsigned M) throw(std::range_error) {
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getParallelMating() const { return parallelMating; }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setVectorizedCrossover(bool enable) {
+	vectorizedCrossover = enable;
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getVectorizedCrossover() const { return vectorizedCrossover; }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setCounterBasedRandom(bool enable) {
+	// Draw the seed of the streams from refRNG the first time this mode is enabled:
+	if(enable && !counterBased && counterSeed == 0) { counterSeed = refRNG.randInt() | 1UL; }
+
+	counterBased = enable;
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getCounterBasedRandom() const { return counterBased; }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setThreadPool(bool enable, bool pinned) {
+	// Replace the pools if they are missing or pinned differently:
+	if(enable && (pools.empty() || pools[0]->getPinned() != pinned)) {
+		for(unsigned i = 0; i < pools.size(); ++i) { delete pools[i]; }
+		pools.clear();
+		for(unsigned i = 0; i < K; ++i) {
+			pools.push_back(new ThreadPool(MAX_THREADS, pinned, i * MAX_THREADS));
+		}
+	}
+
+	threadPool = enable;
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getThreadPool() const { return threadPool; }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setDynamicScheduling(bool enable, unsigned chunk) {
+	dynamicChunk = (enable ? (chunk > 0 ? chunk : 1) : 0);
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getDynamicScheduling() const { return dynamicChunk > 0; }
+
+template< class Decoder, class RNG, class Key >
+const typename BRKGA< Decoder, RNG, Key >::DecodeStatistics&
+BRKGA< Decoder, RNG, Key >::getDecodeStatistics(unsigned k) const {
+	#ifdef RANGECHECK
+		if(k >= K) { throw std::range_error("Invalid population identifier."); }
+	#endif
+	return statistics[k];
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setFitnessCache(bool enable, unsigned capacity) {
+	delete cache;
+	cache = (enable ? new FitnessCache(capacity) : 0);
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getFitnessCache() const { return cache != 0; }
+
+template< class Decoder, class RNG, class Key >
+unsigned long BRKGA< Decoder, RNG, Key >::getCacheHits() const {
+	return (cache != 0 ? cache->getHits() : 0);
+}
+
+template< class Decoder, class RNG, class Key >
+unsigned long BRKGA< Decoder, RNG, Key >::getCacheMisses() const {
+	return (cache != 0 ? cache->getMisses() : 0);
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setScreening(bool enable, double fraction) {
+	screening = (enable && fraction > 0.0 ? (fraction < 1.0 ? fraction : 1.0) : 0.0);
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getScreening() const { return screening > 0.0; }
+
+template< class Decoder, class RNG, class Key >
+double BRKGA< Decoder, RNG, Key >::getScreeningFraction() const { return screening; }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setDeltaDecoding(bool enable) {
+	if(!enable || !HasDeltaDecode< Decoder, Key >::value) {
+		for(unsigned i = 0; i < deltas.size(); ++i) { delete deltas[i]; }
+		deltas.clear();
+		return;
+	}
+
+	// No state is known yet; they are built as chromosomes get decoded:
+	while(deltas.size() < K) { deltas.push_back(new Deltas(p)); }
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getDeltaDecoding() const { return !deltas.empty(); }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setSpeculativeMutants(bool enable) {
+	if(!enable || pm == 0) {
+		for(unsigned i = 0; i < spares.size(); ++i) { delete spares[i]; }
+		spares.clear();
+		return;
+	}
+
+	// The first generation breeds its own mutants, while the spares get decoded:
+	while(spares.size() < K) { spares.push_back(new BasicPopulation< Key >(n, pm)); }
+	std::fill(ready.begin(), ready.end(), 0);
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getSpeculativeMutants() const { return !spares.empty(); }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setSteadyState(bool enable) {
+	if(!enable) {
+		for(unsigned i = 0; i < steady.size(); ++i) { delete steady[i]; delete children[i]; }
+		steady.clear();
+		children.clear();
+		return;
+	}
+
+	const unsigned T = (MAX_THREADS > 1 ? MAX_THREADS : 1);
+	while(steady.size() < K) {
+		steady.push_back(new SteadyState(p));
+		children.push_back(new BasicPopulation< Key >(n, T));
+	}
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getSteadyState() const { return !steady.empty(); }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::setAsyncDecoding(bool enable, unsigned _inFlight) {
+	inFlight = (enable && HasAsyncDecode< Decoder, Key >::value ? (_inFlight > 0 ? _inFlight : 1) :
+			0);
+}
+
+template< class Decoder, class RNG, class Key >
+bool BRKGA< Decoder, RNG, Key >::getAsyncDecoding() const { return inFlight > 0; }
+
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::getInFlight() const { return inFlight; }
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::writeCheckpoint(std::ostream& out) const
+		throw(std::runtime_error) {
+	CheckpointWriter checkpoint;
+
+	// Parameters:
+	checkpoint.put(n);
+	checkpoint.put(p);
+	checkpoint.put(pe);
+	checkpoint.put(pm);
+	checkpoint.put(rhoe);
+	checkpoint.put(K);
+	checkpoint.put(MAX_THREADS);
+
+	// Generators and options:
+	writeRNG(checkpoint, refRNG);
+	checkpoint.put(char(parallelIslands));
+	checkpoint.put((unsigned long) islandRNG.size());
+	for(unsigned i = 0; i < islandRNG.size(); ++i) { writeRNG(checkpoint, *islandRNG[i]); }
+	checkpoint.put(char(parallelMating));
+	checkpoint.put((unsigned long) streams.size());
+	for(unsigned i = 0; i < streams.size(); ++i) { writeRNG(checkpoint, *streams[i]); }
+	checkpoint.put(char(vectorizedCrossover));
+	checkpoint.put(char(counterBased));
+	checkpoint.put(counterSeed);
+	checkpoint.put(&epoch[0], K);
+	checkpoint.put(char(threadPool));
+	checkpoint.put(char(!pools.empty() && pools[0]->getPinned()));
+	checkpoint.put(dynamicChunk);
+	for(unsigned i = 0; i < K; ++i) {
+		const DecodeStatistics& stats = statistics[i];
+		checkpoint.put(stats.decodes);
+		checkpoint.put(stats.threads);
+		checkpoint.put(stats.wallTime);
+		checkpoint.put(stats.busyTime);
+		checkpoint.put(stats.meanTime);
+		checkpoint.put(stats.maxTime);
+	}
+
+	checkpoint.put(char(cache != 0));
+	if(cache != 0) {
+		checkpoint.put(cache->getCapacity());
+		cache->write(checkpoint);
+	}
+
+	checkpoint.put(screening);
+	checkpoint.put(inFlight);
+	checkpoint.put(char(!deltas.empty()));
+	checkpoint.put(char(!spares.empty()));
+	checkpoint.put(&ready[0], K);
+	for(unsigned i = 0; i < spares.size(); ++i) { writePopulation(checkpoint, *spares[i]); }
+	checkpoint.put(char(!steady.empty()));
+	for(unsigned i = 0; i < steady.size(); ++i) {
+		checkpoint.put(&steady[i]->born[0], p);
+		checkpoint.put(steady[i]->clock);
+		checkpoint.put(steady[i]->jobs);
+	}
+
+	// Populations:
+	for(unsigned i = 0; i < K; ++i) {
+		writePopulation(checkpoint, *current[i]);
+		writePopulation(checkpoint, *previous[i]);
+	}
+
+	// Incumbent:
+	std::vector< Key > keys;
+	checkpoint.put(getIncumbent(keys));
+	checkpoint.put(&keys[0], n);
+
+	checkpoint.write(out, sizeof(Key));
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::readCheckpoint(std::istream& in) throw(std::runtime_error) {
+	CheckpointReader checkpoint(in, sizeof(Key));
+
+	// Parameters, which must match before anything is changed:
+	unsigned _n, _p, _pe, _pm, _K, _MAX_THREADS;
+	double _rhoe;
+	checkpoint.get(_n);
+	checkpoint.get(_p);
+	checkpoint.get(_pe);
+	checkpoint.get(_pm);
+	checkpoint.get(_rhoe);
+	checkpoint.get(_K);
+	checkpoint.get(_MAX_THREADS);
+	if(_n != n || _p != p || _pe != pe || _pm != pm || _rhoe != rhoe || _K != K ||
+			_MAX_THREADS != MAX_THREADS) {
+		throw std::runtime_error("Checkpoint of a BRKGA with other parameters.");
+	}
+
+	// Generators and options (the setters create whatever the options need, which is then
+	// overwritten; they may draw from refRNG, which is therefore restored last):
+	char flag, pinned;
+	unsigned long count;
+	std::istringstream refState(checkpoint.getString());
+	checkpoint.get(flag);
+	checkpoint.get(count);
+	if(count > 0) { setParallelIslands(true); }
+	for(unsigned i = 0; i < count; ++i) { readRNG(checkpoint, *islandRNG[i]); }
+	parallelIslands = (flag != 0);
+	checkpoint.get(flag);
+	checkpoint.get(count);
+	if(count > 0) { setParallelMating(true); }
+	for(unsigned i = 0; i < count; ++i) { readRNG(checkpoint, *streams[i]); }
+	parallelMating = (flag != 0);
+	checkpoint.get(flag);
+	vectorizedCrossover = (flag != 0);
+	checkpoint.get(flag);
+	counterBased = (flag != 0);
+	checkpoint.get(counterSeed);
+	checkpoint.get(&epoch[0], K);
+	checkpoint.get(flag);
+	checkpoint.get(pinned);
+	setThreadPool(flag != 0, pinned != 0);
+	checkpoint.get(dynamicChunk);
+	for(unsigned i = 0; i < K; ++i) {
+		DecodeStatistics& stats = statistics[i];
+		checkpoint.get(stats.decodes);
+		checkpoint.get(stats.threads);
+		checkpoint.get(stats.wallTime);
+		checkpoint.get(stats.busyTime);
+		checkpoint.get(stats.meanTime);
+		checkpoint.get(stats.maxTime);
+	}
+
+	checkpoint.get(flag);
+	setFitnessCache(false);
+	if(flag != 0) {
+		unsigned capacity;
+		checkpoint.get(capacity);
+		setFitnessCache(true, capacity);
+		cache->read(checkpoint);
+	}
+
+	checkpoint.get(screening);
+	checkpoint.get(inFlight);
+	checkpoint.get(flag);
+	setDeltaDecoding(false);	// No State is known
+	setDeltaDecoding(flag != 0);
+	checkpoint.get(flag);
+	setSpeculativeMutants(false);
+	setSpeculativeMutants(flag != 0);
+	checkpoint.get(&ready[0], K);
+	for(unsigned i = 0; i < spares.size(); ++i) { readPopulation(checkpoint, *spares[i]); }
+	checkpoint.get(flag);
+	setSteadyState(false);
+	setSteadyState(flag != 0);
+	for(unsigned i = 0; i < steady.size(); ++i) {
+		checkpoint.get(&steady[i]->born[0], p);
+		checkpoint.get(steady[i]->clock);
+		checkpoint.get(steady[i]->jobs);
+	}
+
+	// Populations:
+	for(unsigned i = 0; i < K; ++i) {
+		readPopulation(checkpoint, *current[i]);
+		readPopulation(checkpoint, *previous[i]);
+	}
+
+	// Incumbent:
+	double fitness;
+	std::vector< Key > keys(n);
+	checkpoint.get(fitness);
+	checkpoint.get(&keys[0], n);
+	incumbent.clear();
+	incumbent.offer(fitness, &keys[0]);
+
+	refState >> refRNG;
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::exchangeElite(unsigned M) throw(std::range_error) {
 	#ifdef RANGECHECK
 		if(M == 0 || M >= p) { throw std::range_error("M cannot be zero or >= p."); }
 	#endif
 
+	// The worst chromosomes are replaced below, so the populations must be fully sorted:
+	for(unsigned i = 0; i < K; ++i) { current[i]->completeSort(); }
+
 	for(unsigned i = 0; i < K; ++i) {
 		// Population i will receive some elite members from each Population j below:
 		unsigned dest = p - 1;	// Last chromosome of i (will be updated below)
@@ -271,11 +1331,14 @@ void BRKGA< Decoder, RNG >::exchangeElite(unsigned M) throw(std::range_error) {
 			// Copy the M best of Population j into Population i:
 			for(unsigned m = 0; m < M; ++m) {
 				// Copy the m-th best of Population j into the 'dest'-th position of Population i:
-				const std::vector< double >& bestOfJ = current[j]->getChromosome(m);
+				const BasicChromosome< Key >& bestOfJ = current[j]->getChromosome(m);
 
 				std::copy(bestOfJ.begin(), bestOfJ.end(), current[i]->getChromosome(dest).begin());
 
 				current[i]->fitness[dest].first = current[j]->fitness[m].first;
+				if(!deltas.empty()) {
+					deltas[i]->valid[stateOf(*current[i], i, current[i]->fitness[dest].second)] = 0;
+				}
 
 				--dest;
 			}
@@ -285,97 +1348,783 @@ void BRKGA< Decoder, RNG >::exchangeElite(unsigned M) throw(std::range_error) {
 	for(int j = 0; j < int(K); ++j) { current[j]->sortFitness(); }
 }
 
-template< class Decoder, class RNG >
-inline void BRKGA< Decoder, RNG >::initialize(const unsigned i) {
-	for(unsigned j = 0; j < p; ++j) {
-		for(unsigned k = 0; k < n; ++k) { (*current[i])(j, k) = refRNG.rand(); }
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::initialize(const unsigned i,
+		const std::vector< std::vector< Key > >* seeds) {
+	// Rows are split into blocks, which are filled in parallel when mating is parallel or
+	// counter-based (block b of island i then draws from stream b of island i):
+	const unsigned blocks = ((parallelMating || counterBased) && MAX_THREADS > 1 ? MAX_THREADS : 1);
+	const FillTask fillTask = { this, i, blocks, ++epoch[i] };
+	parallelFor(i, blocks, fillTask, blocks > 1);
+
+	// The seeds replace the first rows (which are drawn all the same, to keep the streams as they
+	// would be after a reset()):
+	for(unsigned j = 0; seeds != 0 && j < seeds->size(); ++j) {
+		std::copy((*seeds)[j].begin(), (*seeds)[j].end(), (*current[i])(j).data());
 	}
 
-	// Decode:
-	#ifdef _OPENMP
-		#pragma omp parallel for num_threads(MAX_THREADS)
-	#endif
-	for(int j = 0; j < int(p); ++j) {
-		current[i]->setFitness(j, refDecoder.decode((*current[i])(j)) );
+	// Decode from scratch (with no elite set to compare against yet):
+	if(!deltas.empty()) {
+		std::fill(deltas[i]->parent.begin(), deltas[i]->parent.end(), p);
+		std::fill(deltas[i]->valid.begin(), deltas[i]->valid.end(), 0);
 	}
+	evaluate(*current[i], i, 0, p, std::numeric_limits< double >::infinity());
+
+	// Spare mutants drawn before the reset are dropped:
+	ready[i] = 0;
 
 	// Sort:
 	current[i]->sortFitness();
+	publish(i);
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::checkSeeds(const std::vector< std::vector< Key > >& chromosomes,
+		const unsigned k) const throw(std::range_error) {
+	using std::range_error;
+	if(k >= K) { throw range_error("Invalid population identifier."); }
+	if(chromosomes.size() > p) { throw range_error("More chromosomes than population size (p)."); }
+	for(unsigned j = 0; j < chromosomes.size(); ++j) {
+		if(chromosomes[j].size() != n) { throw range_error("Chromosome size differs from n."); }
+		for(unsigned l = 0; l < n; ++l) {
+			const double key = KeyTraits< Key >::toDouble(chromosomes[j][l]);
+			if(!(key >= 0.0 && key < 1.0)) { throw range_error("Key out of range [0,1)."); }
+		}
+	}
+}
+
+template< class Decoder, class RNG, class Key >
+inline bool BRKGA< Decoder, RNG, Key >::evolveAll(const unsigned generations) {
+	const bool islands = (parallelIslands && K > 1);
+	if(islands || !steady.empty()) {
+		// The islands do not interact within evolve(), so each thread runs all generations of its
+		// own island (in steady state, as one run of jobs); let each of them open its own team of
+		// decoding threads:
+		#ifdef _OPENMP
+			if(islands && omp_get_max_active_levels() < 2) { omp_set_max_active_levels(2); }
+			#pragma omp parallel for num_threads(K) schedule(static, 1) if(islands)
+		#endif
+		for(int j = 0; j < int(K); ++j) { evolveIsland(j, generations); }
+
+		return !stopped;
+	}
+
+	for(unsigned i = 0; i < generations; ++i) {
+		for(unsigned j = 0; j < K; ++j) {
+			if(!evolveIsland(j, 1)) { return false; }
+		}
+	}
+
+	return true;
 }
 
-template< class Decoder, class RNG >
-inline void BRKGA< Decoder, RNG >::evolution(Population& curr, Population& next) {
+template< class Decoder, class RNG, class Key >
+inline bool BRKGA< Decoder, RNG, Key >::evolveIsland(const unsigned k,
+		const unsigned generations) {
+	if(!steady.empty()) {
+		const bool done = steadyState(k, generations);
+		publish(k);
+		return done;
+	}
+
+	for(unsigned i = 0; i < generations; ++i) {
+		// First evolve the population (curr, next), then update (prev = curr; curr = prev == next):
+		if(!evolution(*current[k], *previous[k], k)) { return false; }
+
+		std::swap(current[k], previous[k]);
+		if(!deltas.empty()) { deltas[k]->current.swap(deltas[k]->previous); }
+		publish(k);
+	}
+
+	return true;
+}
+
+template< class Decoder, class RNG, class Key >
+inline bool BRKGA< Decoder, RNG, Key >::evolution(BasicPopulation< Key >& curr,
+		BasicPopulation< Key >& next, const unsigned k) {
+	if(expired()) { return false; }
+
 	// We now will set every chromosome of 'current', iterating with 'i':
 	unsigned i = 0;	// Iterate chromosome by chromosome
-	unsigned j = 0;	// Iterate allele by allele
 
-	// 2. The 'pe' best chromosomes are maintained, so we just copy these into 'current':
+	// 2. The 'pe' best chromosomes are maintained; rather than copying their keys into 'next', we
+	//    hand their rows over by swapping row views (the rows given back to 'curr' are discarded):
 	while(i < pe) {
-		for(j = 0 ; j < n; ++j) { next(i,j) = curr(curr.fitness[i].second, j); }
+		next.swapRows(i, curr, curr.fitness[i].second);
 
 		next.fitness[i].first = curr.fitness[i].first;
 		next.fitness[i].second = i;
+
+		// The state of the row goes along ('next' is previous[k] and 'curr' is current[k]):
+		if(!deltas.empty()) {
+			std::swap(deltas[k]->previous[i], deltas[k]->current[curr.fitness[i].second]);
+		}
 		++i;
 	}
 
-	// 3. We'll mate 'p - pe - pm' pairs; initially, i = pe, so we need to iterate until i < p - pm:
-	while(i < p - pm) {
-		// Select an elite parent:
-		const unsigned eliteParent = (refRNG.randInt(pe - 1));
+	// 3. Offspring and mutants fill positions pe, ..., p - 1, except for the mutants decoded
+	//    during the previous generation, if any, which are handed over as positions p - pm, ...:
+	const unsigned long generation = ++epoch[k];
+	const bool speculated = (!spares.empty() && ready[k]);
+	if(speculated) { takeSpares(next, k); }
 
-		// Select a non-elite parent:
-		const unsigned noneliteParent = pe + (refRNG.randInt(p - pe - 1));
+	//    The others are split into blocks, which are bred in parallel when mating is parallel
+	//    (block b of island k then draws from stream b of island k) or counter-based (each
+	//    position then has its own generators):
+	const unsigned end = (speculated ? p - pm : p);
+	const unsigned blocks = ((parallelMating || counterBased) && MAX_THREADS > 1 ? MAX_THREADS : 1);
+	const BreedTask breedTask = { this, &curr, &next, k, blocks, generation, end };
+	if(spares.empty()) {
+		parallelFor(k, blocks, breedTask, blocks > 1);
+	}
+	else {
+		// Threads that are not breeding decode the mutants of the next generation meanwhile:
+		if(!counterBased) {
+			RNG& rng = (parallelMating ? *streams[k * streams.size() / K] :
+					(parallelIslands ? *islandRNG[k] : refRNG));
+			for(unsigned s = 0; s < pm; ++s) {
+				KeyTraits< Key >::fill(rng, (*spares[k])(s).data(), n);
+			}
+		}
+
+		const SpeculateTask speculateTask = { this, &breedTask, generation + 1 };
+		parallelFor(k, blocks + pm, speculateTask, true, 1);
+		ready[k] = 1;
+	}
 
-		// Mate:
-		for(j = 0; j < n; ++j) {
-			const unsigned& sourceParent = ((refRNG.rand() < rhoe) ? eliteParent : noneliteParent);
+	// Time to compute fitness, in parallel; chromosomes worse than the elite set may be cut short:
+	evaluate(next, k, pe, end, next.fitness[pe - 1].first);
 
-			next(i, j) = curr(curr.fitness[sourceParent].second, j);
+	// A generation cut short (or whose last decodes may have given up) is discarded: the elite
+	// rows go back to 'curr', which is otherwise unchanged, and the spare mutants are drawn again:
+	if(stopped || cancelled()) {
+		stopped = 1;
+		for(unsigned e = 0; e < pe; ++e) {
+			next.swapRows(e, curr, curr.fitness[e].second);
+			if(!deltas.empty()) {
+				std::swap(deltas[k]->previous[e], deltas[k]->current[curr.fitness[e].second]);
+			}
 		}
 
-		++i;
+		--epoch[k];
+		ready[k] = 0;
+		return false;
 	}
 
-	// We'll introduce 'pm' mutants:
-	while(i < p) {
-		for(j = 0; j < n; ++j) { next(i, j) = refRNG.rand(); }
-		++i;
+	// Now we must sort 'current' by fitness, since things might have changed; only the elite set
+	// needs to be in order for the next generation (the rest is sorted on demand by Population):
+	next.sortFitness(pe);
+	return true;
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::fill(const unsigned k, const unsigned b,
+		const unsigned blocks, const unsigned long generation) {
+	const unsigned first = unsigned((std::size_t(p) * b) / blocks);
+	const unsigned last = unsigned((std::size_t(p) * (b + 1)) / blocks);
+	for(unsigned j = first; j < last; ++j) {
+		if(counterBased) {
+			PhiloxRand genes(counterSeed, k, generation, j, 1);
+			KeyTraits< Key >::fill(genes, (*current[k])(j).data(), n);
+		}
+		else {
+			RNG& rng = (parallelMating ? *streams[k * streams.size() / K + b] : refRNG);
+			KeyTraits< Key >::fill(rng, (*current[k])(j).data(), n);
+		}
+	}
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::breed(BasicPopulation< Key >& curr,
+		BasicPopulation< Key >& next, const unsigned k, const unsigned b, const unsigned blocks,
+		const unsigned long generation, const unsigned end) {
+	const unsigned first = pe + unsigned((std::size_t(end - pe) * b) / blocks);
+	const unsigned last = pe + unsigned((std::size_t(end - pe) * (b + 1)) / blocks);
+
+	std::vector< unsigned > words(vectorizedCrossover ? n : 0);	// Random words per offspring
+	for(unsigned j = first; j < last; ++j) {
+		if(counterBased) {
+			PhiloxRand parents(counterSeed, k, generation, j, 0);
+			PhiloxRand genes(counterSeed, k, generation, j, 1);
+			const unsigned parent = breed(curr, next, j, parents, genes, words);
+			if(!deltas.empty()) { record(next, k, j, parent); }
+		}
+		else {
+			RNG& rng = (parallelMating ? *streams[k * streams.size() / K + b] :
+					(parallelIslands ? *islandRNG[k] : refRNG));
+			const unsigned parent = breed(curr, next, j, rng, rng, words);
+			if(!deltas.empty()) { record(next, k, j, parent); }
+		}
+	}
+
+	// Predict that mutants take as long to decode as the average chromosome did:
+	const unsigned mutants = (first > p - pm ? first : p - pm);
+	for(unsigned j = mutants; j < last; ++j) { next.cost[j] = statistics[k].meanTime; }
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::speculate(const unsigned k, const unsigned s,
+		const unsigned long generation, Workspace& workspace) {
+	BasicPopulation< Key >& spare = *spares[k];
+	if(counterBased) {
+		// The keys that mutant p - pm + s of that generation would get without speculation:
+		PhiloxRand genes(counterSeed, k, generation, p - pm + s, 1);
+		KeyTraits< Key >::fill(genes, spare(s).data(), n);
+	}
+
+	decode(spare, k, s, std::numeric_limits< double >::infinity(), workspace);
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::takeSpares(BasicPopulation< Key >& next,
+		const unsigned k) {
+	BasicPopulation< Key >& spare = *spares[k];
+	for(unsigned s = 0; s < pm; ++s) {
+		// Copy the keys (rather than swapping rows, so that 'next' never points into 'spare',
+		// which setSpeculativeMutants(false) may free):
+		const unsigned i = p - pm + s;
+		std::copy(spare(s).data(), spare(s).data() + n, next(i).data());
+		next.cost[i] = spare.cost[s];
+		next.setFitness(i, spare.fitness[s].first);
+		if(!deltas.empty()) { record(next, k, i, p); }	// Its state is unknown
+	}
+}
+
+template< class Decoder, class RNG, class Key >
+inline bool BRKGA< Decoder, RNG, Key >::steadyState(const unsigned k,
+		const unsigned generations) {
+	// Jobs insert into a fully ranked population:
+	current[k]->completeSort();
+
+	SteadyState& state = *steady[k];
+	const unsigned long last = state.jobs + (unsigned long) generations * (p - pe);
+	const SteadyTask task = { this, k, &state.jobs, last };
+	epoch[k] += generations;
+	parallelFor(k, unsigned(workspaces.size() / K), task, true, 1);
+	if(state.jobs > last) { state.jobs = last; }	// Claimed past the last job
+
+	if(cancelled()) { stopped = 1; }
+	return !stopped;
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::steadyJob(const unsigned k, const unsigned long job,
+		const unsigned t) {
+	BasicPopulation< Key >& population = *current[k];
+	BasicPopulation< Key >& child = *children[k];	// Row t belongs to this thread
+	SteadyState& state = *steady[k];
+
+	// Breed from the population as it stands (other threads may replace the parents afterwards,
+	// so the keys are copied before the lock is released):
+	std::vector< unsigned > words(vectorizedCrossover ? n : 0);
+	state.lock();
+	const double cutoff = population.fitness[pe - 1].first;
+	RNG& rng = (parallelIslands ? *islandRNG[k] : refRNG);
+	Key* offspring = child(t).data();
+	if(job % (p - pe) >= p - pe - pm) {
+		KeyTraits< Key >::fill(rng, offspring, n);
+		child.cost[t] = statistics[k].meanTime;
+	}
+	else {
+		const unsigned eliteParent = population.fitness[rng.randInt(pe - 1)].second;
+		const unsigned noneliteParent = population.fitness[pe + rng.randInt(p - pe - 1)].second;
+		const Key* elite = population(eliteParent).data();
+		const Key* nonelite = population(noneliteParent).data();
+		if(vectorizedCrossover) {
+			BulkRandom< RNG >::fillUInt32(rng, &words[0], n);
+			crossover(elite, nonelite, offspring, &words[0], n, crossoverThreshold);
+		}
+		else {
+			for(unsigned j = 0; j < n; ++j) {
+				offspring[j] = ((rng.rand() < rhoe) ? elite[j] : nonelite[j]);
+			}
+		}
+	}
+	state.unlock();
+
+	const unsigned threads = unsigned(workspaces.size() / K);
+	decode(child, k, t, cutoff, *workspaces[k * threads + t]);
+	if(cancelled()) { return; }	// The decoder may have given up
+
+	// Replace the oldest non-elite chromosome (the worst one among the oldest):
+	state.lock();
+	std::vector< std::pair< double, unsigned > >& ranking = population.fitness;
+	unsigned rank = pe;
+	for(unsigned r = pe + 1; r < p; ++r) {
+		if(state.born[ranking[r].second] <= state.born[ranking[rank].second]) { rank = r; }
+	}
+
+	const unsigned victim = ranking[rank].second;
+	std::copy(offspring, offspring + n, population(victim).data());
+	population.cost[victim] = child.cost[t];
+	state.born[victim] = ++state.clock;
+	if(!deltas.empty()) { deltas[k]->valid[stateOf(population, k, victim)] = 0; }
+
+	// Move it to its rank:
+	const std::pair< double, unsigned > entry(child.fitness[t].first, victim);
+	ranking.erase(ranking.begin() + rank);
+	ranking.insert(std::lower_bound(ranking.begin(), ranking.end(), entry), entry);
+	state.unlock();
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::evaluate(BasicPopulation< Key >& population,
+		const unsigned k, const unsigned first, const unsigned last, const double cutoff) {
+	// Screening needs an elite set to rank the chromosomes that are not decoded after:
+	const bool screen = (screening > 0.0 && HasEstimate< Decoder, Key >::value &&
+			cutoff < std::numeric_limits< double >::infinity());
+	if(!screen && inFlight == 0 && (dynamicChunk == 0 || HasDecodeBatch< Decoder, Key >::value)) {
+		const DecodeTask task = { this, &population, k, first, last - first,
+				getBatches(last - first), 0, cutoff };
+		parallelFor(k, task.batches, task, true);
+		return;
+	}
+
+	if(first >= last) { return; }
+
+	std::vector< unsigned >& sequence = order[k];
+	sequence.resize(last - first);
+	for(unsigned i = first; i < last; ++i) { sequence[i - first] = i; }
+
+	unsigned count = last - first;	// Decode sequence[0], ..., sequence[count - 1]
+	if(screen) {
+		const EstimateTask estimateTask = { this, &population, k, first };
+		parallelFor(k, last - first, estimateTask, true, dynamicChunk);
+
+		// Decode the best estimated ones only; the others must rank after every elite:
+		count = unsigned(screening * (last - first) + 0.5);
+		if(count == 0) { count = 1; }
+		if(count > last - first) { count = last - first; }
+
+		const FitnessOrder fitnessOrder = { &population.fitness };
+		std::nth_element(sequence.begin(), sequence.begin() + count, sequence.end(), fitnessOrder);
+		for(unsigned j = count; j < last - first; ++j) {
+			const unsigned i = sequence[j];
+			if(population.fitness[i].first < cutoff) { population.setFitness(i, cutoff); }
+		}
+	}
+
+	// Decode the chromosomes with the largest predicted cost first:
+	const CostOrder costOrder = { &population.cost };
+	if(dynamicChunk > 0) { std::sort(sequence.begin(), sequence.begin() + count, costOrder); }
+
+	const double start = now();
+	if(inFlight > 0) {
+		decodeAsync(population, k, &sequence[0], count);
+	}
+	else {
+		const DecodeTask task = { this, &population, k, first, count, count, &sequence[0], cutoff };
+		parallelFor(k, count, task, true, dynamicChunk);
+	}
+
+	// Gather the statistics of this decode phase:
+	DecodeStatistics& stats = statistics[k];
+	stats.wallTime = now() - start;
+	stats.decodes = count;
+	stats.threads = (inFlight > 0 ? 1 :
+			(threadPool ? pools[k]->getThreads() : (MAX_THREADS > 1 ? MAX_THREADS : 1)));
+	stats.busyTime = 0.0;
+	stats.maxTime = 0.0;
+	for(unsigned j = 0; j < count; ++j) {
+		const double cost = population.cost[sequence[j]];
+		stats.busyTime += cost;
+		if(cost > stats.maxTime) { stats.maxTime = cost; }
+	}
+
+	stats.meanTime = stats.busyTime / stats.decodes;
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::decode(BasicPopulation< Key >& population,
+		const unsigned k, const unsigned first, const unsigned last, const double cutoff,
+		Workspace& workspace, Scratch& buffers) {
+	// Before either path, so batches too honour the deadline and the token; reset() and the
+	// injections also come through here, but expired() is false outside of evolve():
+	if(expired()) { return; }
+
+	const bool batch = (HasDecodeBatch< Decoder, Key >::value && deltas.empty());
+	if(batch && cache == 0) {
+		// Hand the row views over as one batch:
+		std::vector< double >& fitness = buffers.fitness;
+		fitness.resize(last - first);
+		BatchDecoder< Decoder, Key >::decode(refDecoder, &population.population[first],
+				last - first, &fitness[0], workspace);
+		for(unsigned i = first; i < last; ++i) { population.setFitness(i, fitness[i - first]); }
+
+		return;
+	}
+
+	if(batch) {
+		// Hand over the views of the chromosomes missing from the cache as one batch:
+		std::vector< unsigned >& misses = buffers.misses;
+		std::vector< FitnessCache::Hash >& hashes = buffers.hashes;
+		std::vector< BasicChromosome< Key > >& views = buffers.views;
+		misses.clear();
+		hashes.clear();
+		views.clear();
+		for(unsigned i = first; i < last; ++i) {
+			const FitnessCache::Hash hash = FitnessCache::hash(population.population[i].data(), n);
+			double fitness;
+			if(cache->find(hash, fitness, cutoff)) { population.setFitness(i, fitness); continue; }
+
+			misses.push_back(i);
+			hashes.push_back(hash);
+			views.push_back(population.population[i]);
+		}
+
+		if(views.empty()) { return; }
+
+		std::vector< double >& fitness = buffers.fitness;
+		fitness.resize(views.size());
+		BatchDecoder< Decoder, Key >::decode(refDecoder, &views[0], unsigned(views.size()),
+				&fitness[0], workspace);
+		const bool kept = !cancelled();	// Otherwise the decoder may have given up
+		for(unsigned m = 0; m < misses.size(); ++m) {
+			if(kept) { remember(views[m], hashes[m], fitness[m], false); }
+			population.setFitness(misses[m], fitness[m]);
+		}
+
+		return;
+	}
+
+	for(unsigned i = first; i < last && !expired(); ++i) {
+		population.setFitness(i, fitnessOf(population, k, i, cutoff, workspace));
+	}
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::decode(BasicPopulation< Key >& population,
+		const unsigned k, const unsigned i, const double cutoff, Workspace& workspace) {
+	const double start = now();
+	population.setFitness(i, fitnessOf(population, k, i, cutoff, workspace));
+	population.cost[i] = now() - start;
+}
+
+template< class Decoder, class RNG, class Key >
+inline double BRKGA< Decoder, RNG, Key >::fitnessOf(BasicPopulation< Key >& population,
+		const unsigned k, const unsigned i, const double cutoff, Workspace& workspace) {
+	BasicChromosome< Key >& chromosome = population.population[i];
+	FitnessCache::Hash hash = FitnessCache::Hash();
+	double fitness = 0.0;
+	if(cache != 0) {
+		hash = FitnessCache::hash(chromosome.data(), n);
+		if(cache->find(hash, fitness, cutoff)) { return fitness; }
+	}
+
+	bool bound = false;
+	if(!deltas.empty() && (&population == current[k] || &population == previous[k])) {
+		// Decode from the state of the elite parent, if it is known:
+		Deltas& delta = *deltas[k];
+		const unsigned parent = delta.parent[i];
+		const unsigned state = stateOf(population, k, i);
+		const unsigned parentState = (parent < p ? stateOf(population, k, parent) : state);
+		const std::vector< unsigned >& genes = delta.genes[i];
+		fitness = DeltaDecoder< Decoder, Key >::decode(refDecoder, chromosome,
+				(parent < p && delta.valid[parentState] ? &delta.states[parentState] : 0),
+				(genes.empty() ? 0 : &genes[0]), unsigned(genes.size()), delta.states[state],
+				workspace);
+		delta.valid[state] = 1;
+	}
+	else {
+		// Fitness above the cutoff may be a lower bound only if the decoder could stop early:
+		fitness = BoundedDecoder< Decoder, Key >::decode(refDecoder, chromosome, cutoff, workspace);
+		bound = (HasBoundedDecode< Decoder, Key >::value && fitness > cutoff);
+	}
+
+	if(cache != 0 && !cancelled()) { remember(chromosome, hash, fitness, bound); }
+	return fitness;
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::decodeRows(BasicPopulation< Key >& population,
+		const unsigned k, const unsigned* rows, const unsigned count) {
+	if(inFlight > 0) {
+		decodeAsync(population, k, rows, count);
+		return;
+	}
+
+	const DecodeTask task = { this, &population, k, 0, count, count, rows,
+			std::numeric_limits< double >::infinity() };
+	parallelFor(k, count, task, true, dynamicChunk);
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::decodeAsync(BasicPopulation< Key >& population,
+		const unsigned k, const unsigned* rows, const unsigned count) {
+	typedef typename AsyncDecoder< Decoder, Key >::Request Request;
+	const unsigned slots = (count < inFlight ? count : inFlight);
+	std::vector< Request > requests(slots);			// Evaluation in slot s, if any
+	std::vector< unsigned > row(slots);				// Its chromosome
+	std::vector< double > start(slots);				// Its submission time
+	std::vector< FitnessCache::Hash > hashes(slots);	// Hash of its keys when submitted
+	std::vector< unsigned > active;					// Slots in flight, oldest first
+	std::vector< unsigned > idle;					// Free slots
+	for(unsigned s = slots; s > 0; --s) { idle.push_back(s - 1); }
+
+	Workspace& workspace = *workspaces[k * (workspaces.size() / K)];
+	unsigned next = 0;	// Next chromosome to submit
+	while((next < count && !expired()) || !active.empty()) {
+		// Fill the free slots (none once the deadline has passed; those in flight are waited for):
+		while(next < count && !idle.empty() && !expired()) {
+			const unsigned i = rows[next++];
+			BasicChromosome< Key >& chromosome = population.population[i];
+			double fitness;
+			FitnessCache::Hash hash = FitnessCache::Hash();
+			if(cache != 0) {
+				hash = FitnessCache::hash(chromosome.data(), n);
+				if(cache->find(hash, fitness)) { population.setFitness(i, fitness); continue; }
+			}
+
+			const unsigned s = idle.back();
+			idle.pop_back();
+			row[s] = i;
+			start[s] = now();
+			hashes[s] = hash;
+			requests[s] = AsyncDecoder< Decoder, Key >::submit(refDecoder, chromosome, workspace);
+			active.push_back(s);
+		}
+
+		// Collect the evaluations that are done; if none is, wait for the oldest one:
+		for(bool wait = false; !active.empty(); wait = true) {
+			unsigned kept = 0;
+			for(unsigned a = 0; a < active.size(); ++a) {
+				const unsigned s = active[a];
+				double fitness;
+				if(!AsyncDecoder< Decoder, Key >::complete(refDecoder, requests[s], fitness,
+						wait && a == 0)) {
+					active[kept++] = s;
+					continue;
+				}
+
+				const unsigned i = row[s];
+				population.setFitness(i, fitness);
+				population.cost[i] = now() - start[s];
+				if(cache != 0 && !cancelled()) {
+					remember(population.population[i], hashes[s], fitness, false);
+				}
+				idle.push_back(s);
+			}
+
+			const bool done = (kept < active.size());
+			active.resize(kept);
+			if(done) { break; }
+		}
+	}
+
+	// No State was built for these chromosomes:
+	if(!deltas.empty()) {
+		Deltas& delta = *deltas[k];
+		for(unsigned j = 0; j < count; ++j) { delta.valid[stateOf(population, k, rows[j])] = 0; }
+	}
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::remember(const BasicChromosome< Key >& chromosome,
+		const FitnessCache::Hash& hash, double fitness, bool bound) {
+	cache->insert(hash, fitness, bound);
+
+	// decode() may have changed the keys; the changed chromosome has the same fitness:
+	const FitnessCache::Hash changed = FitnessCache::hash(chromosome.data(), n);
+	if(changed != hash) { cache->insert(changed, fitness, bound); }
+}
+
+template< class Decoder, class RNG, class Key >
+inline unsigned BRKGA< Decoder, RNG, Key >::stateOf(const BasicPopulation< Key >& population,
+		const unsigned k, const unsigned i) const {
+	const Deltas& delta = *deltas[k];
+	return (&population == current[k] ? delta.current[i] : delta.previous[i]);
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::record(BasicPopulation< Key >& next, const unsigned k,
+		const unsigned i, const unsigned parent) {
+	Deltas& delta = *deltas[k];
+	delta.valid[stateOf(next, k, i)] = 0;	// Until chromosome i is decoded
+	delta.parent[i] = parent;
+	delta.genes[i].clear();
+	if(parent >= p) { return; }
+
+	const Key* offspring = next(i).data();
+	const Key* elite = next(parent).data();
+	for(unsigned j = 0; j < n; ++j) {
+		if(offspring[j] != elite[j]) { delta.genes[i].push_back(j); }
+	}
+}
+
+template< class Decoder, class RNG, class Key >
+inline double BRKGA< Decoder, RNG, Key >::now() {
+	#ifdef _OPENMP
+		return omp_get_wtime();
+	#else
+		timeval time;
+		gettimeofday(&time, 0);
+		return time.tv_sec + 1e-6 * time.tv_usec;
+	#endif
+}
+
+template< class Decoder, class RNG, class Key >
+inline bool BRKGA< Decoder, RNG, Key >::expired() {
+	if(stopped) { return true; }
+	if(!evolving) { return false; }
+	if(halted || cancelled()) { stopped = 1; return true; }
+	if(deadline == std::numeric_limits< double >::infinity() || now() < deadline) { return false; }
+
+	stopped = 1;
+	return true;
+}
+
+template< class Decoder, class RNG, class Key >
+inline bool BRKGA< Decoder, RNG, Key >::cancelled() const {
+	return token != 0 && token->isCancelled();
+}
+
+template< class Decoder, class RNG, class Key >
+void* BRKGA< Decoder, RNG, Key >::runBackground(void* arg) {
+	Background& run = *static_cast< Background* >(arg);
+	run.done = run.brkga->evolve(run.generations, run.seconds, run.target, run.stall);
+	run.brkga->running = 0;
+	return 0;
+}
+
+template< class Decoder, class RNG, class Key >
+inline void BRKGA< Decoder, RNG, Key >::publish(const unsigned k) {
+	const BasicPopulation< Key >& population = *current[k];
+	incumbent.offer(population.fitness[0].first,
+			population.population[population.fitness[0].second].data());
+}
+
+template< class Decoder, class RNG, class Key >
+inline unsigned BRKGA< Decoder, RNG, Key >::getBatches(const unsigned count) const {
+	if(! HasDecodeBatch< Decoder, Key >::value) { return count; }
+
+	const unsigned batches = (MAX_THREADS > 1 ? MAX_THREADS : 1);
+	return (count < batches ? count : batches);
+}
+
+template< class Decoder, class RNG, class Key >
+template< class Task >
+inline void BRKGA< Decoder, RNG, Key >::parallelFor(const unsigned k, const unsigned count,
+		const Task& task, bool parallel, const unsigned chunk) {
+	if(threadPool && parallel) {
+		pools[k]->run(task, count, (chunk > 0 ? chunk : 1));
+		return;
 	}
 
-	// Time to compute fitness, in parallel:
 	#ifdef _OPENMP
-		#pragma omp parallel for num_threads(MAX_THREADS)
+		if(chunk > 0) {
+			#pragma omp parallel for num_threads(MAX_THREADS) schedule(dynamic, chunk) if(parallel)
+			for(int i = 0; i < int(count); ++i) {
+				task(unsigned(i), unsigned(omp_get_thread_num()));
+			}
+
+			return;
+		}
+
+		#pragma omp parallel for num_threads(MAX_THREADS) if(parallel)
+		for(int i = 0; i < int(count); ++i) { task(unsigned(i), unsigned(omp_get_thread_num())); }
+	#else
+		(void) chunk;
+		for(int i = 0; i < int(count); ++i) { task(unsigned(i), 0); }
 	#endif
-	for(int i = int(pe); i < int(p); ++i) {
-		next.setFitness( i, refDecoder.decode(next.population[i]) );
+}
+
+template< class Decoder, class RNG, class Key >
+template< class ParentRNG, class GeneRNG >
+inline unsigned BRKGA< Decoder, RNG, Key >::breed(BasicPopulation< Key >& curr,
+		BasicPopulation< Key >& next, const unsigned i, ParentRNG& parentRNG, GeneRNG& geneRNG,
+		std::vector< unsigned >& words) {
+	// We'll introduce mutants from p - pm on:
+	if(i >= p - pm) {
+		KeyTraits< Key >::fill(geneRNG, next(i).data(), n);
+		return p;
+	}
+
+	// Otherwise, mate. Select an elite parent:
+	const unsigned eliteParent = (parentRNG.randInt(pe - 1));
+
+	// Select a non-elite parent:
+	const unsigned noneliteParent = pe + (parentRNG.randInt(p - pe - 1));
+
+	// Mate, reading from and writing to contiguous rows (the elite rows now belong to 'next'):
+	const Key* elite = next(eliteParent).data();
+	const Key* nonelite = curr(curr.fitness[noneliteParent].second).data();
+	next.cost[i] = 0.5 * (next.cost[eliteParent] + curr.cost[curr.fitness[noneliteParent].second]);
+	Key* offspring = next(i).data();
+	if(vectorizedCrossover) {
+		BulkRandom< GeneRNG >::fillUInt32(geneRNG, &words[0], n);
+		crossover(elite, nonelite, offspring, &words[0], n, crossoverThreshold);
+	}
+	else {
+		for(unsigned j = 0; j < n; ++j) {
+			offspring[j] = ((geneRNG.rand() < rhoe) ? elite[j] : nonelite[j]);
+		}
 	}
 
-	// Now we must sort 'current' by fitness, since things might have changed:
-	next.sortFitness();
+	return eliteParent;
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::writePopulation(CheckpointWriter& out,
+		const BasicPopulation< Key >& population) const {
+	// Rows in the order of their views (which swapRows() may have permuted):
+	for(unsigned i = 0; i < population.p; ++i) { out.put(population.population[i].data(), n); }
+	for(unsigned i = 0; i < population.p; ++i) {
+		out.put(population.fitness[i].first);
+		out.put(population.fitness[i].second);
+	}
+
+	out.put(population.sorted);
+	out.put(&population.cost[0], population.p);
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::readPopulation(CheckpointReader& in,
+		BasicPopulation< Key >& population) {
+	for(unsigned i = 0; i < population.p; ++i) { in.get(population.population[i].data(), n); }
+	for(unsigned i = 0; i < population.p; ++i) {
+		in.get(population.fitness[i].first);
+		in.get(population.fitness[i].second);
+	}
+
+	in.get(population.sorted);
+	in.get(&population.cost[0], population.p);
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::writeRNG(CheckpointWriter& out, const RNG& rng) {
+	std::ostringstream state;
+	state << rng;
+	out.putString(state.str());
+}
+
+template< class Decoder, class RNG, class Key >
+void BRKGA< Decoder, RNG, Key >::readRNG(CheckpointReader& in, RNG& rng) {
+	std::istringstream state(in.getString());
+	state >> rng;
 }
 
-template< class Decoder, class RNG >
-unsigned BRKGA<Decoder, RNG>::getN() const { return n; }
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::getN() const { return n; }
 
-template< class Decoder, class RNG >
-unsigned BRKGA<Decoder, RNG>::getP() const { return p; }
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::getP() const { return p; }
 
-template< class Decoder, class RNG >
-unsigned BRKGA<Decoder, RNG>::getPe() const { return pe; }
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::getPe() const { return pe; }
 
-template< class Decoder, class RNG >
-unsigned BRKGA<Decoder, RNG>::getPm() const { return pm; }
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::getPm() const { return pm; }
 
-template< class Decoder, class RNG >
-unsigned BRKGA<Decoder, RNG>::getPo() const { return p - pe - pm; }
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::getPo() const { return p - pe - pm; }
 
-template< class Decoder, class RNG >
-double BRKGA<Decoder, RNG>::getRhoe() const { return rhoe; }
+template< class Decoder, class RNG, class Key >
+double BRKGA< Decoder, RNG, Key >::getRhoe() const { return rhoe; }
 
-template< class Decoder, class RNG >
-unsigned BRKGA<Decoder, RNG>::getK() const { return K; }
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::getK() const { return K; }
 
-template< class Decoder, class RNG >
-unsigned BRKGA<Decoder, RNG>::getMAX_THREADS() const { return MAX_THREADS; }
+template< class Decoder, class RNG, class Key >
+unsigned BRKGA< Decoder, RNG, Key >::getMAX_THREADS() const { return MAX_THREADS; }
 
 #endif
@@ -0,0 +1,153 @@
+/**
+ * Chromosome.h
+ *
+ * A lightweight view over the n random keys of a single chromosome. Population keeps all of its
+ * keys in one contiguous buffer and hands out Chromosome objects that point into it, so no key is
+ * ever copied when a chromosome is passed to a Decoder. A Chromosome does not own its keys: it is
+ * only valid while the Population (or std::vector) it was built from is alive and unchanged.
+ *
+ * BasicChromosome is parameterized on the type of the random keys (see KeyTraits.h), and
+ * Chromosome is the usual view over double keys. Decoders see the same operations they used with
+ * std::vector< double >: size() and operator[], which reads (and writes) real numbers in [0,1)
+ * regardless of Key. Both begin()/end() and data() give access to the raw keys instead, which lets
+ * decoders compare fixed-point keys without converting them. A BasicChromosome can also be built
+ * from a std::vector< Key >, which is convenient to decode or rebuild solutions stored outside of
+ * BRKGA.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CHROMOSOME_H
+#define CHROMOSOME_H
+
+#include <vector>
+#include <exception>
+#include <stdexcept>
+#include "KeyTraits.h"
+
+template< class Key >
+class BasicChromosome {
+public:
+	typedef Key* iterator;
+	typedef const Key* const_iterator;
+	typedef typename KeyTraits< Key >::Reference reference;
+
+	BasicChromosome();								// Empty view (size() == 0)
+	BasicChromosome(Key* keys, unsigned n);			// View over keys[0], ..., keys[n - 1]
+	BasicChromosome(std::vector< Key >& keys);		// View over the contents of a vector
+	BasicChromosome(const BasicChromosome& other);
+	BasicChromosome& operator=(const BasicChromosome& other);
+
+	unsigned size() const;	// Number of keys (n)
+
+	reference operator[](unsigned j);			// Allele j as a real number in [0,1)
+	double operator[](unsigned j) const;
+
+	iterator begin();		// Raw keys
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	Key* data();			// Pointer to the first raw key
+	const Key* data() const;
+
+private:
+	Key* keys;		// First key of this chromosome (not owned)
+	unsigned n;		// Number of keys
+};
+
+typedef BasicChromosome< double > Chromosome;
+
+template< class Key >
+inline BasicChromosome< Key >::BasicChromosome() : keys(0), n(0) {
+}
+
+template< class Key >
+inline BasicChromosome< Key >::BasicChromosome(Key* _keys, unsigned _n) : keys(_keys), n(_n) {
+}
+
+template< class Key >
+inline BasicChromosome< Key >::BasicChromosome(std::vector< Key >& v) :
+		keys(v.empty() ? 0 : &v[0]), n(unsigned(v.size())) {
+}
+
+template< class Key >
+inline BasicChromosome< Key >::BasicChromosome(const BasicChromosome& other) :
+		keys(other.keys), n(other.n) {
+}
+
+template< class Key >
+inline BasicChromosome< Key >& BasicChromosome< Key >::operator=(const BasicChromosome& other) {
+	keys = other.keys;
+	n = other.n;
+	return *this;
+}
+
+template< class Key >
+inline unsigned BasicChromosome< Key >::size() const { return n; }
+
+template< class Key >
+inline typename BasicChromosome< Key >::reference BasicChromosome< Key >::operator[](unsigned j) {
+	#ifdef RANGECHECK
+		if(j >= n) { throw std::range_error("Invalid allele identifier."); }
+	#endif
+	return reference(keys[j]);
+}
+
+template< class Key >
+inline double BasicChromosome< Key >::operator[](unsigned j) const {
+	#ifdef RANGECHECK
+		if(j >= n) { throw std::range_error("Invalid allele identifier."); }
+	#endif
+	return KeyTraits< Key >::toDouble(keys[j]);
+}
+
+template< class Key >
+inline typename BasicChromosome< Key >::iterator BasicChromosome< Key >::begin() { return keys; }
+
+template< class Key >
+inline typename BasicChromosome< Key >::iterator BasicChromosome< Key >::end() { return keys + n; }
+
+template< class Key >
+inline typename BasicChromosome< Key >::const_iterator BasicChromosome< Key >::begin() const {
+	return keys;
+}
+
+template< class Key >
+inline typename BasicChromosome< Key >::const_iterator BasicChromosome< Key >::end() const {
+	return keys + n;
+}
+
+template< class Key >
+inline Key* BasicChromosome< Key >::data() { return keys; }
+
+template< class Key >
+inline const Key* BasicChromosome< Key >::data() const { return keys; }
+
+#endif
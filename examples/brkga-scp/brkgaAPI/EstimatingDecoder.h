@@ -0,0 +1,127 @@
+/**
+ * EstimatingDecoder.h
+ *
+ * Lets decoders with a cheap approximation of their fitness screen the offspring of a generation
+ * (see BRKGA::setScreening()). Besides decode(), a Decoder may implement
+ *     - double estimate(Chromosome& chromosome) const, or
+ *     - double estimate(const Chromosome& chromosome) const,
+ * (taking a Workspace& as a second argument if it declares a Workspace; see Workspace.h), which
+ * returns an approximation of decode(chromosome) that ranks chromosomes roughly as decode() does,
+ * e.g. a constructive heuristic without its local search. With screening enabled, BRKGA estimates
+ * every offspring and mutant and then decodes only the best estimated fraction of them; estimate()
+ * must therefore be thread-safe too. Any changes made to the chromosome by estimate() are kept.
+ *
+ * EstimatingDecoder< Decoder, Key >::estimate() calls estimate() if Decoder has one and decode()
+ * otherwise. The choice is made at compile time.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef ESTIMATINGDECODER_H
+#define ESTIMATINGDECODER_H
+
+#include "Chromosome.h"
+#include "Workspace.h"
+
+/**
+ * HasEstimate< Decoder, Key >::value is true iff Decoder declares either estimate() above:
+ */
+template< class Decoder, class Key, bool workspace = HasWorkspace< Decoder >::value >
+class HasEstimate {
+	template< class T, double (T::*)(BasicChromosome< Key >&) const >
+	struct Check { };
+
+	template< class T, double (T::*)(const BasicChromosome< Key >&) const >
+	struct CheckConst { };
+
+	template< class T >
+	static char test(Check< T, &T::estimate >*);
+
+	template< class T >
+	static long test(...);
+
+	template< class T >
+	static char testConst(CheckConst< T, &T::estimate >*);
+
+	template< class T >
+	static long testConst(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char) ||
+			sizeof(testConst< Decoder >(0)) == sizeof(char)) };
+};
+
+template< class Decoder, class Key >
+class HasEstimate< Decoder, Key, true > {
+	typedef typename Decoder::Workspace Workspace;
+
+	template< class T, double (T::*)(BasicChromosome< Key >&, Workspace&) const >
+	struct Check { };
+
+	template< class T, double (T::*)(const BasicChromosome< Key >&, Workspace&) const >
+	struct CheckConst { };
+
+	template< class T >
+	static char test(Check< T, &T::estimate >*);
+
+	template< class T >
+	static long test(...);
+
+	template< class T >
+	static char testConst(CheckConst< T, &T::estimate >*);
+
+	template< class T >
+	static long testConst(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char) ||
+			sizeof(testConst< Decoder >(0)) == sizeof(char)) };
+};
+
+template< class Decoder, class Key, bool estimating = HasEstimate< Decoder, Key >::value >
+struct EstimatingDecoder {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+
+	static double estimate(const Decoder& decoder, BasicChromosome< Key >& chromosome,
+			Workspace& workspace) {
+		return WorkspaceTraits< Decoder >::decode(decoder, chromosome, workspace);
+	}
+};
+
+template< class Decoder, class Key >
+struct EstimatingDecoder< Decoder, Key, true > {
+	typedef typename WorkspaceTraits< Decoder >::Workspace Workspace;
+
+	static double estimate(const Decoder& decoder, BasicChromosome< Key >& chromosome,
+			Workspace& workspace) {
+		return WorkspaceTraits< Decoder >::estimate(decoder, chromosome, workspace);
+	}
+};
+
+#endif
@@ -13,7 +13,7 @@ TSPDecoder::TSPDecoder(const TSPInstance& _instance) : instance(_instance) {
 TSPDecoder::~TSPDecoder() {
 }
 
-double TSPDecoder::decode(const std::vector< double >& chromosome) const {
+double TSPDecoder::decode(const Chromosome& chromosome) const {
 	// 1) Solve the problem (i.e., create a tour out of this chromosome):
 	// Avoids race conditions by making sure we have a single TSPSolver for each thread calling
 	// ::decode (as long as TSPSolver does not make use of 'static' or other gimmicks):
@@ -26,3 +26,22 @@ double TSPDecoder::decode(const std::vector< double >& chromosome) const {
 	return double(fitness);
 }
 
+double TSPDecoder::decode(const Chromosome& chromosome, Workspace& workspace) const {
+	// Each thread has its own workspace, so the tour is only allocated on its first call:
+	return double(TSPSolver::solve(instance, chromosome, workspace.tour));
+}
+
+double TSPDecoder::decode(const Chromosome& chromosome, double cutoff,
+		Workspace& workspace) const {
+	// Tours longer than 'cutoff' cannot be elite: BRKGA only needs to know they are longer:
+	return double(TSPSolver::solve(instance, chromosome, workspace.tour, cutoff));
+}
+
+double TSPDecoder::decodeDelta(const Chromosome& chromosome, const State* parent,
+		const unsigned* genes, unsigned count, State& state, Workspace& workspace) const {
+	if(parent == 0) { return double(TSPSolver::solve(instance, chromosome, state.tour)); }
+
+	// The workspace holds the nodes whose keys changed:
+	return double(TSPSolver::solve(instance, chromosome, parent->tour, genes, count,
+			workspace.tour, state.tour));
+}
@@ -10,14 +10,40 @@
 
 #include "TSPSolver.h"
 #include "TSPInstance.h"
+#include "brkgaAPI/Chromosome.h"
 
 class TSPDecoder {
 public:
 	TSPDecoder(const TSPInstance& instance);
 	virtual ~TSPDecoder();
 
+	// Scratch space of one thread, reused by BRKGA across calls to decode():
+	struct Workspace {
+		Workspace() : tour() { }
+		std::vector< TSPSolver::ValueKeyPair > tour;
+	};
+
+	// Decoded chromosome, which BRKGA keeps for delta decoding:
+	struct State {
+		State() : tour() { }
+		std::vector< TSPSolver::ValueKeyPair > tour;	// Nodes sorted by key
+	};
+
 	// Decodes a chromosome into a solution to the TSP:
-	double decode(const std::vector< double >& chromosome) const;
+	double decode(const Chromosome& chromosome) const;
+
+	// Same, but reuses the memory in 'workspace':
+	double decode(const Chromosome& chromosome, Workspace& workspace) const;
+
+	// Same, but stops adding up the tour once it is longer than 'cutoff' (BRKGA calls this one,
+	// but only for speculative mutants and with no cutoff once delta decoding is enabled):
+	double decode(const Chromosome& chromosome, double cutoff, Workspace& workspace) const;
+
+	// Same, but keeps the tour in 'state' and, given the state of a 'parent' that differs from
+	// 'chromosome' in 'count' genes only, re-sorts just these (BRKGA calls this one if delta
+	// decoding is enabled):
+	double decodeDelta(const Chromosome& chromosome, const State* parent, const unsigned* genes,
+			unsigned count, State& state, Workspace& workspace) const;
 
 private:
 	const TSPInstance& instance;
@@ -7,9 +7,15 @@
 
 #include "TSPSolver.h"
 
-TSPSolver::TSPSolver(const TSPInstance& instance, const std::vector< double >& chromosome) :
-		distance(0), tour(instance.getNumNodes()) {
+TSPSolver::TSPSolver(const TSPInstance& instance, const Chromosome& chromosome) :
+		distance(0), tour() {
+	distance = solve(instance, chromosome, tour);
+}
+
+unsigned TSPSolver::solve(const TSPInstance& instance, const Chromosome& chromosome,
+		std::vector< ValueKeyPair >& tour, double cutoff) {
 	// Assumes that instance.getNumNodes() == chromosome.size() of course
+	tour.resize(instance.getNumNodes());
 
 	// 1) Obtain a permutation out of the chromosome -- this will be the tour:
 	for(unsigned i = 0; i < chromosome.size(); ++i) { tour[i] = ValueKeyPair(chromosome[i], i); }
@@ -18,18 +24,59 @@ TSPSolver::TSPSolver(const TSPInstance& instance, const std::vector< double >& c
 	std::sort(tour.begin(), tour.end());
 
 	// 2) Compute the distance of the tour given by the permutation:
+	return getDistance(instance, tour, cutoff);
+}
+
+unsigned TSPSolver::solve(const TSPInstance& instance, const Chromosome& chromosome,
+		const std::vector< ValueKeyPair >& parentTour, const unsigned* genes, unsigned count,
+		std::vector< ValueKeyPair >& changed, std::vector< ValueKeyPair >& tour) {
+	// 1) Sort the nodes whose keys changed:
+	changed.resize(count);
+	for(unsigned i = 0; i < count; ++i) {
+		changed[i] = ValueKeyPair(chromosome[genes[i]], genes[i]);
+	}
+
+	std::sort(changed.begin(), changed.end());
+
+	// 2) Merge them with the other nodes, which are still sorted in 'parentTour' (an entry of
+	//    'parentTour' is out of date iff its key is no longer the key of its node):
+	tour.resize(parentTour.size());
+	unsigned next = 0;
+	unsigned c = 0;
+	for(unsigned i = 0; i < parentTour.size(); ++i) {
+		const ValueKeyPair& entry = parentTour[i];
+		if(chromosome[entry.second] != entry.first) { continue; }
+
+		while(c < count && changed[c] < entry) { tour[next++] = changed[c++]; }
+		tour[next++] = entry;
+	}
+
+	while(c < count) { tour[next++] = changed[c++]; }
+
+	// 3) Compute the distance of the tour given by the permutation:
+	return getDistance(instance, tour, std::numeric_limits< double >::infinity());
+}
+
+unsigned TSPSolver::getDistance(const TSPInstance& instance,
+		const std::vector< ValueKeyPair >& tour, double cutoff) {
+	unsigned distance = 0;
 	for(unsigned i = 1; i < tour.size(); ++i) {
 		// Compute distance(i-1, i) in the permutation:
 		const unsigned& source = tour[i-1].second;
 		const unsigned& destination = tour[i].second;
 
 		distance += instance.getDistance(source, destination);
+
+		// Distances are not negative, so the tour cannot get shorter than this:
+		if(distance > cutoff) { return distance; }
 	}
 
 	// Close the tour:
 	const unsigned& last = tour.back().second;
 	const unsigned& first = tour.front().second;
 	distance += instance.getDistance(last, first);
+
+	return distance;
 }
 
 TSPSolver::~TSPSolver() {
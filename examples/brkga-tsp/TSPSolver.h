@@ -13,20 +13,40 @@
 #include <vector>
 #include <algorithm>
 #include "TSPInstance.h"
+#include "brkgaAPI/Chromosome.h"
 
 class TSPSolver {
 public:
 	// The constructor 'solves' the problem in O(n log n) by transforming the chromosome into
 	// a tour (by getting a permutation out of the chromosome):
-	TSPSolver(const TSPInstance& instance, const std::vector< double >& chromosome);
+	TSPSolver(const TSPInstance& instance, const Chromosome& chromosome);
 	virtual ~TSPSolver();
 
 	unsigned getTourDistance() const;		// Returns the tour distance
 	std::list< unsigned > getTour() const;	// Returns the tour (first node not copied in the end)
 
-private:
 	typedef std::pair< double, unsigned > ValueKeyPair;
 
+	// Solves the problem like the constructor does, but into a caller-supplied 'tour' (resized to
+	// the number of nodes), so that 'tour' can be reused; returns the tour distance, or a partial
+	// distance greater than 'cutoff' as soon as the tour is known to be longer than that:
+	static unsigned solve(const TSPInstance& instance, const Chromosome& chromosome,
+			std::vector< ValueKeyPair >& tour,
+			double cutoff = std::numeric_limits< double >::infinity());
+
+	// Solves the problem into 'tour' given 'parentTour', the tour of a chromosome that differs
+	// from 'chromosome' only in the keys of nodes genes[0], ..., genes[count - 1]: these nodes are
+	// sorted by their new keys (in 'changed') and merged with the others in O(n + count log count)
+	// time, instead of sorting all n nodes; returns the tour distance:
+	static unsigned solve(const TSPInstance& instance, const Chromosome& chromosome,
+			const std::vector< ValueKeyPair >& parentTour, const unsigned* genes, unsigned count,
+			std::vector< ValueKeyPair >& changed, std::vector< ValueKeyPair >& tour);
+
+private:
+	// Distance of 'tour', or a partial distance greater than 'cutoff':
+	static unsigned getDistance(const TSPInstance& instance,
+			const std::vector< ValueKeyPair >& tour, double cutoff);
+
 	unsigned distance;
 	std::vector< ValueKeyPair > tour;
 };
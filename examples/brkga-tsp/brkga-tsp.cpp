@@ -38,6 +38,8 @@
 
 #include <iostream>
 #include <algorithm>
+#include <limits>
+#include <sys/time.h>
 #include "brkgaAPI/BRKGA.h"
 #include "brkgaAPI/MTRand.h"
 
@@ -45,13 +47,20 @@
 #include "TSPDecoder.h"
 #include "TSPInstance.h"
 
+// Wall-clock time in seconds (clock() would sum the CPU time of all threads):
+double now() {
+	timeval time;
+	gettimeofday(&time, 0);
+	return time.tv_sec + 1e-6 * time.tv_usec;
+}
+
 int main(int argc, char* argv[]) {
 	if(argc < 2) { std::cerr << "usage: <TSPLIB-file>" << std::endl; return -1; }
 
 	std::cout << "Welcome to the BRKGA API sample driver.\nFinding a (heuristic) minimizer for "
 			<< " the TSP." << std::endl;
 
-	const clock_t begin = clock();
+	const double begin = now();
 
 	const std::string instanceFile = std::string(argv[1]);
 	std::cout << "Instance file: " << instanceFile << std::endl;
@@ -80,6 +89,38 @@ int main(int argc, char* argv[]) {
 
 	// initialize the BRKGA-based heuristic
 	BRKGA< TSPDecoder, MTRand > algorithm(n, p, pe, pm, rhoe, decoder, rng, K, MAXT);
+	algorithm.setParallelIslands(true);	// evolve the K populations concurrently
+	algorithm.setVectorizedCrossover(true);	// mate with bulk random words (see Crossover.h)
+	// Decode offspring from the tour of their elite parent. decodeDelta() always completes the
+	// tour, so the decode() that stops at the elite cutoff is left to the speculative mutants,
+	// which have no cutoff: disable this to see the tours cut short (see TSPDecoder.h):
+	algorithm.setDeltaDecoding(true);
+	algorithm.setSpeculativeMutants(true);	// decode next mutants while mating (see BRKGA.h)
+
+	// Warm start: encode a nearest-neighbor tour as keys (the j-th node visited gets key j / n)
+	// and inject it into each population, in place of its worst chromosome (the constructor has
+	// already decoded the random ones, so only the tour is decoded; seedPopulation() would decode
+	// the whole population again):
+	std::vector< std::vector< double > > seeds(1, std::vector< double >(n));
+	std::vector< bool > visited(n, false);
+	unsigned node = 0;
+	for(unsigned j = 0; j < n; ++j) {
+		seeds[0][node] = j / double(n);
+		visited[node] = true;
+		unsigned nearest = n;
+		for(unsigned v = 0; v < n; ++v) {
+			if(!visited[v] && (nearest == n ||
+					instance.getDistance(node, v) < instance.getDistance(node, nearest))) {
+				nearest = v;
+			}
+		}
+
+		node = nearest;
+	}
+
+	for(unsigned i = 0; i < K; ++i) { algorithm.injectChromosomes(seeds, i); }
+	std::cout << "Seeded with a nearest-neighbor tour of length " << algorithm.getBestFitness()
+			<< std::endl;
 
 	// BRKGA inner loop (evolution) configuration: Exchange top individuals
 	const unsigned X_INTVL = 100;	// exchange best individuals at every 100 generations
@@ -94,7 +135,7 @@ int main(int argc, char* argv[]) {
 
 	// Print info about multi-threading:
 	#ifdef _OPENMP
-		std::cout << "Running for " << MAX_GENS << " generations using " << MAXT
+		std::cout << "Running for " << MAX_GENS << " generations using " << K << " x " << MAXT
 				<< " out of " << omp_get_max_threads()
 				<< " available thread units..." << std::endl;
 	#endif
@@ -113,7 +154,8 @@ int main(int argc, char* argv[]) {
 			// Save the best solution to be used after the evolution chain:
 			relevantGeneration = generation;
 			bestFitness = algorithm.getBestFitness();
-			bestChromosome = algorithm.getBestChromosome();
+			bestChromosome.assign(algorithm.getBestChromosome().begin(),
+					algorithm.getBestChromosome().end());
 			
 			std::cout << "\t" << generation
 					<< ") Improved best solution thus far: "
@@ -167,8 +209,7 @@ int main(int argc, char* argv[]) {
 	}
 	std::cout << std::endl;
 
-	const clock_t end = clock();
-	std::cout << "BRKGA run finished in " << (end - begin) / double(CLOCKS_PER_SEC) << " s." << std::endl;
+	std::cout << "BRKGA run finished in " << now() - begin << " s." << std::endl;
 
 	return 0;
 }
@@ -0,0 +1,151 @@
+/**
+ * Crossover.h
+ *
+ * Parameterized uniform crossover kernels used by BRKGA when vectorized crossover is enabled (see
+ * BRKGA::setVectorizedCrossover()). Instead of drawing one double per gene and comparing it with
+ * rhoe, the caller draws one 32-bit word per gene in bulk and the kernel inherits gene j from the
+ * elite parent iff words[j] < threshold, where threshold = rhoeThreshold(rhoe). The selection is
+ * branch-free and, for double and float keys, uses SIMD blends when the compiler targets AVX-512F
+ * (-mavx512f) or AVX2 (-mavx2); otherwise a scalar loop is used (which the compiler may still
+ * vectorize). All paths produce exactly the same offspring for the same words.
+ *
+ * Since words are uniform in [0, 2^32), an allele comes from the elite parent with probability
+ * threshold / 2^32, which differs from rhoe by less than 2^-32.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CROSSOVER_H
+#define CROSSOVER_H
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
+/**
+ * Returns the 32-bit threshold matching probability rhoe (rhoe >= 1 maps to 2^32 - 1):
+ */
+inline unsigned rhoeThreshold(double rhoe) {
+	if(rhoe <= 0.0) { return 0; }
+	const double threshold = rhoe * 4294967296.0;
+	return (threshold >= 4294967295.0 ? 0xffffffffU : unsigned(threshold));
+}
+
+/**
+ * offspring[j] = (words[j] < threshold ? elite[j] : nonelite[j]), for j = 0, ..., n - 1:
+ */
+template< class Key >
+inline void crossover(const Key* elite, const Key* nonelite, Key* offspring,
+		const unsigned* words, unsigned n, unsigned threshold) {
+	for(unsigned j = 0; j < n; ++j) {
+		offspring[j] = (words[j] < threshold ? elite[j] : nonelite[j]);
+	}
+}
+
+#if defined(__AVX512F__)
+
+template<>
+inline void crossover< double >(const double* elite, const double* nonelite, double* offspring,
+		const unsigned* words, unsigned n, unsigned threshold) {
+	const __m512i t = _mm512_set1_epi32(int(threshold));
+	unsigned j = 0;
+	for( ; j + 16 <= n; j += 16) {
+		const __m512i w = _mm512_loadu_si512(reinterpret_cast< const void* >(words + j));
+		const __mmask16 mask = _mm512_cmplt_epu32_mask(w, t);
+
+		_mm512_storeu_pd(offspring + j, _mm512_mask_blend_pd(__mmask8(mask),
+				_mm512_loadu_pd(nonelite + j), _mm512_loadu_pd(elite + j)));
+		_mm512_storeu_pd(offspring + j + 8, _mm512_mask_blend_pd(__mmask8(mask >> 8),
+				_mm512_loadu_pd(nonelite + j + 8), _mm512_loadu_pd(elite + j + 8)));
+	}
+
+	for( ; j < n; ++j) { offspring[j] = (words[j] < threshold ? elite[j] : nonelite[j]); }
+}
+
+template<>
+inline void crossover< float >(const float* elite, const float* nonelite, float* offspring,
+		const unsigned* words, unsigned n, unsigned threshold) {
+	const __m512i t = _mm512_set1_epi32(int(threshold));
+	unsigned j = 0;
+	for( ; j + 16 <= n; j += 16) {
+		const __m512i w = _mm512_loadu_si512(reinterpret_cast< const void* >(words + j));
+		const __mmask16 mask = _mm512_cmplt_epu32_mask(w, t);
+
+		_mm512_storeu_ps(offspring + j, _mm512_mask_blend_ps(mask,
+				_mm512_loadu_ps(nonelite + j), _mm512_loadu_ps(elite + j)));
+	}
+
+	for( ; j < n; ++j) { offspring[j] = (words[j] < threshold ? elite[j] : nonelite[j]); }
+}
+
+#elif defined(__AVX2__)
+
+// AVX2 has no unsigned comparison: flipping the sign bit of both sides makes a signed one work.
+
+template<>
+inline void crossover< double >(const double* elite, const double* nonelite, double* offspring,
+		const unsigned* words, unsigned n, unsigned threshold) {
+	const __m128i sign = _mm_set1_epi32(int(0x80000000U));
+	const __m128i t = _mm_xor_si128(_mm_set1_epi32(int(threshold)), sign);
+	unsigned j = 0;
+	for( ; j + 4 <= n; j += 4) {
+		const __m128i w = _mm_xor_si128(
+				_mm_loadu_si128(reinterpret_cast< const __m128i* >(words + j)), sign);
+
+		// All ones in 64-bit lane i iff words[j + i] < threshold:
+		const __m256d mask = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmpgt_epi32(t, w)));
+
+		_mm256_storeu_pd(offspring + j,
+				_mm256_blendv_pd(_mm256_loadu_pd(nonelite + j), _mm256_loadu_pd(elite + j), mask));
+	}
+
+	for( ; j < n; ++j) { offspring[j] = (words[j] < threshold ? elite[j] : nonelite[j]); }
+}
+
+template<>
+inline void crossover< float >(const float* elite, const float* nonelite, float* offspring,
+		const unsigned* words, unsigned n, unsigned threshold) {
+	const __m256i sign = _mm256_set1_epi32(int(0x80000000U));
+	const __m256i t = _mm256_xor_si256(_mm256_set1_epi32(int(threshold)), sign);
+	unsigned j = 0;
+	for( ; j + 8 <= n; j += 8) {
+		const __m256i w = _mm256_xor_si256(
+				_mm256_loadu_si256(reinterpret_cast< const __m256i* >(words + j)), sign);
+		const __m256 mask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(t, w));
+
+		_mm256_storeu_ps(offspring + j,
+				_mm256_blendv_ps(_mm256_loadu_ps(nonelite + j), _mm256_loadu_ps(elite + j), mask));
+	}
+
+	for( ; j < n; ++j) { offspring[j] = (words[j] < threshold ? elite[j] : nonelite[j]); }
+}
+
+#endif
+
+#endif
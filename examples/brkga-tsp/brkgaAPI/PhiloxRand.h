@@ -0,0 +1,181 @@
+/**
+ * PhiloxRand.h
+ *
+ * Counter-based random number generator Philox4x32-10 (J.K. Salmon, M.A. Moraes, R.O. Dror and
+ * D.E. Shaw, "Parallel random numbers: as easy as 1, 2, 3", SC'11). Each block of four 32-bit
+ * outputs is a keyed bijection of a 128-bit counter, so any position of any stream can be
+ * computed directly, without generating the numbers that precede it, and generators built with
+ * different stream identifiers never overlap.
+ *
+ * A PhiloxRand is identified by a seed and four stream identifiers (s0, s1, s2, s3): the key is
+ * (seed, s0) and block b of the stream is the image of the counter (b, s1, s2, s3). BRKGA uses
+ * s0 = population, s1 = generation, s2 = chromosome and s3 = purpose in its counter-based mode
+ * (see BRKGA::setCounterBasedRandom()), so every random decision is a pure function of these and
+ * of the position of the gene, regardless of which thread makes it.
+ *
+ * PhiloxRand implements the RNG concept required by BRKGA (see BRKGA.h), with the same semantics
+ * as MTRand (rand() has 53 bits and consumes two 32-bit values), together with the bulk methods
+ * fill() and fillUInt32() (see BulkRandom.h). It is not suitable for cryptography.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef PHILOXRAND_H
+#define PHILOXRAND_H
+
+class PhiloxRand {
+public:
+	typedef unsigned long uint32;	// unsigned integer type, at least 32 bits (as in MTRand)
+
+	explicit PhiloxRand(uint32 seed);	// stream (0, 0, 0, 0) of 'seed'
+	PhiloxRand(uint32 seed, uint32 s0, uint32 s1, uint32 s2, uint32 s3);
+
+	uint32 randInt();					// integer in [0,2^32-1]
+	uint32 randInt(const uint32 n);		// integer in [0,n] for n < 2^32
+	double rand();						// real number in [0,1) with 53-bit resolution
+
+	// Bulk access: same values as n calls to rand() or to randInt()
+	void fill(double* out, unsigned n);
+	void fillUInt32(unsigned int* out, unsigned n);
+
+private:
+	unsigned int key[2];		// (seed, s0)
+	unsigned int counter[4];	// (block, s1, s2, s3)
+	unsigned int output[4];		// Current block
+	unsigned left;				// Number of values of 'output' not yet returned
+
+	void generate();	// Computes the block for 'counter' into 'output' and increments 'counter'
+
+	// hi:lo = a * b (32 x 32 -> 64 bits, with 32-bit arithmetic only):
+	static void mulhilo(unsigned int a, unsigned int b, unsigned int& hi, unsigned int& lo);
+};
+
+inline PhiloxRand::PhiloxRand(uint32 seed) : key(), counter(), output(), left(0) {
+	key[0] = (unsigned int) (seed & 0xffffffffUL);
+	key[1] = 0;
+	counter[0] = counter[1] = counter[2] = counter[3] = 0;
+}
+
+inline PhiloxRand::PhiloxRand(uint32 seed, uint32 s0, uint32 s1, uint32 s2, uint32 s3) :
+		key(), counter(), output(), left(0) {
+	key[0] = (unsigned int) (seed & 0xffffffffUL);
+	key[1] = (unsigned int) (s0 & 0xffffffffUL);
+	counter[0] = 0;
+	counter[1] = (unsigned int) (s1 & 0xffffffffUL);
+	counter[2] = (unsigned int) (s2 & 0xffffffffUL);
+	counter[3] = (unsigned int) (s3 & 0xffffffffUL);
+}
+
+inline void PhiloxRand::mulhilo(unsigned int a, unsigned int b, unsigned int& hi,
+		unsigned int& lo) {
+	const unsigned int a0 = a & 0xffffU, a1 = a >> 16;
+	const unsigned int b0 = b & 0xffffU, b1 = b >> 16;
+	const unsigned int p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+
+	const unsigned int middle = (p00 >> 16) + (p01 & 0xffffU) + (p10 & 0xffffU);
+	lo = (middle << 16) | (p00 & 0xffffU);
+	hi = p11 + (p01 >> 16) + (p10 >> 16) + (middle >> 16);
+}
+
+inline void PhiloxRand::generate() {
+	unsigned int c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+	unsigned int k0 = key[0], k1 = key[1];
+	for(int round = 0; round < 10; ++round) {
+		unsigned int hi0, lo0, hi1, lo1;
+		mulhilo(0xD2511F53U, c0, hi0, lo0);
+		mulhilo(0xCD9E8D57U, c2, hi1, lo1);
+
+		c0 = hi1 ^ c1 ^ k0;
+		c1 = lo1;
+		c2 = hi0 ^ c3 ^ k1;
+		c3 = lo0;
+
+		k0 += 0x9E3779B9U;	// Weyl sequence on the key
+		k1 += 0xBB67AE85U;
+	}
+
+	output[0] = c0; output[1] = c1; output[2] = c2; output[3] = c3;
+	left = 4;
+	++counter[0];
+}
+
+inline PhiloxRand::uint32 PhiloxRand::randInt() {
+	if(left == 0) { generate(); }
+	return output[4 - left--];
+}
+
+inline PhiloxRand::uint32 PhiloxRand::randInt(const uint32 n) {
+	// Same rejection method as MTRand::randInt(n):
+	uint32 used = n;
+	used |= used >> 1;
+	used |= used >> 2;
+	used |= used >> 4;
+	used |= used >> 8;
+	used |= used >> 16;
+
+	uint32 i;
+	do { i = randInt() & used; } while(i > n);
+	return i;
+}
+
+inline double PhiloxRand::rand() {
+	const uint32 a = randInt() >> 5, b = randInt() >> 6;
+	return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+}
+
+inline void PhiloxRand::fillUInt32(unsigned int* out, unsigned n) {
+	// Finish the current block, then write whole blocks straight into 'out':
+	while(n > 0 && left > 0) { *out++ = (unsigned int) randInt(); --n; }
+	while(n >= 4) {
+		generate();
+		out[0] = output[0]; out[1] = output[1]; out[2] = output[2]; out[3] = output[3];
+		left = 0;
+		out += 4;
+		n -= 4;
+	}
+
+	while(n > 0) { *out++ = (unsigned int) randInt(); --n; }
+}
+
+inline void PhiloxRand::fill(double* out, unsigned n) {
+	unsigned int words[512];
+	while(n > 0) {
+		const unsigned count = (n < 256 ? n : 256);
+		fillUInt32(words, 2 * count);
+		for(unsigned i = 0; i < count; ++i) {
+			out[i] = ((words[2 * i] >> 5) * 67108864.0 + (words[2 * i + 1] >> 6))
+					* (1.0 / 9007199254740992.0);
+		}
+
+		out += count;
+		n -= count;
+	}
+}
+
+#endif
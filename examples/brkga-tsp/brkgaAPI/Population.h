@@ -1,17 +1,38 @@
 /**
  * Population.h
  *
- * Encapsulates a population of chromosomes represented by a vector of doubles. We don't decode
+ * Encapsulates a population of chromosomes represented by random keys. We don't decode
  * nor deal with random numbers here; instead, we provide private support methods to set the
  * fitness of a specific chromosome as well as access methods to each allele. Note that the BRKGA
  * class must have access to such methods, thus begin a friend. In terms of design, this class is
  * obviously tightly coupled with BRKGA, and was implemented just to remove unnecessary complexity
  * from the design of BRKGA.
  *
+ * All p chromosomes live in a single contiguous buffer of keys aligned to ALIGNMENT bytes, one row
+ * of n keys per chromosome. Each row starts at an aligned address (rows are padded to a multiple
+ * of ALIGNMENT bytes), and is accessed through a BasicChromosome view (see Chromosome.h). This
+ * avoids one heap allocation per chromosome and keeps the rows close together in memory when
+ * mating.
+ *
+ * Rows are referred to by their views only, so BRKGA can hand a whole chromosome over to another
+ * population by swapping row views instead of copying keys (see swapRows()). As a consequence, a
+ * row view of one population may point into the storage of the other population of the same
+ * island; BRKGA owns both and releases them together.
+ *
+ * BasicPopulation is parameterized on the type of the random keys (see KeyTraits.h), and is
+ * explicitly instantiated in Population.cpp for double, float, unsigned int and unsigned short.
+ * Population is the usual population of double keys.
+ *
  * All public methods in this API *require* the fitness array to be sorted, and thus a call to
  * sortFitness() beforehand. Since this class is tightly coupled with BRKGA, rest assured: 
  * everything will work just fine with a Population obtained from BRKGA.
  *
+ * BRKGA only needs the elite set in order at each generation, so it calls sortFitness(pe), which
+ * places the pe best chromosomes first and in order in O(p + pe log pe) time. The remaining
+ * entries are sorted on demand by the public methods, the first time one of them is asked for a
+ * chromosome that is not among the pe best. Hence the public methods do reorder 'fitness' (which
+ * is mutable): do not call them concurrently on the same population.
+ *
  * Created on : Jun 21, 2010 by rtoso
  * Last update: Nov 15, 2010 by rtoso
  * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
@@ -47,12 +68,15 @@
 #define POPULATION_H
 
 #include <vector>
+#include <cstddef>
 #include <algorithm>
 #include <exception>
 #include <stdexcept>
+#include "Chromosome.h"
 
-class Population {
-	template< class Decoder, class RNG >
+template< class Key >
+class BasicPopulation {
+	template< class Decoder, class RNG, class K >
 	friend class BRKGA;
 
 public:
@@ -68,22 +92,43 @@ public:
 	double getFitness(unsigned i) const;
 	
 	// Returns (i+1)-th best chromosome, where i = 0 is the best and i = getP() - 1 is the worst:
-	const std::vector< double >& getChromosome(unsigned i) const;
+	const BasicChromosome< Key >& getChromosome(unsigned i) const;
+
+	static const unsigned ALIGNMENT = 64;	// Alignment (in bytes) of each row of keys
 
 private:
-	Population(const Population& other);
-	Population(unsigned n, unsigned p);
-	~Population();
+	BasicPopulation(const BasicPopulation& other);
+	BasicPopulation(unsigned n, unsigned p);
+	~BasicPopulation();
 
-	std::vector< std::vector< double > > population;		// Population as vectors of prob.
-	std::vector< std::pair< double, unsigned > > fitness;	// Fitness (double) of a each chromosome
+	const unsigned n;		// Number of genes in each chromosome
+	const unsigned p;		// Number of chromosomes
+	const unsigned stride;	// Distance (in keys) between the first keys of consecutive rows
+
+	Key* storage;			// Block returned by new[] (owned)
+	Key* keys;				// First aligned key in 'storage'
+	std::vector< BasicChromosome< Key > > population;		// Row views (see swapRows())
+	mutable std::vector< std::pair< double, unsigned > > fitness;	// Fitness of each chromosome
+	mutable unsigned sorted;	// Number of leading entries of 'fitness' known to be in order
+	std::vector< double > cost;	// Seconds taken to decode each row (predicted, for offspring)
 
 	void sortFitness();									// Sorts 'fitness' by its first parameter
+	void sortFitness(unsigned top);						// Sorts only the 'top' best entries
+	void completeSort() const;							// Sorts whatever sortFitness(top) left
 	void setFitness(unsigned i, double f);				// Sets the fitness of chromosome i
-	std::vector< double >& getChromosome(unsigned i);	// Returns a chromosome
+	BasicChromosome< Key >& getChromosome(unsigned i);	// Returns a chromosome
+
+	Key& operator()(unsigned i, unsigned j);				// Direct access to allele j of chromosome i
+	BasicChromosome< Key >& operator()(unsigned i);		// Direct access to chromosome i
+
+	// Exchanges row i with row j of 'other' without copying any keys:
+	void swapRows(unsigned i, BasicPopulation& other, unsigned j);
 
-	double& operator()(unsigned i, unsigned j);		// Direct access to allele j of chromosome i
-	std::vector< double >& operator()(unsigned i);	// Direct access to chromosome i
+	void allocate();	// Allocates 'storage' and sets 'keys' and the row views
+
+	BasicPopulation& operator=(const BasicPopulation& other);	// Not allowed
 };
 
+typedef BasicPopulation< double > Population;
+
 #endif
@@ -0,0 +1,139 @@
+/**
+ * Workspace.h
+ *
+ * Per-thread scratch space for decoders. Since decode() must be thread-safe (and should not use
+ * mutable members), a decoder that needs temporary buffers would otherwise allocate them on every
+ * call. Instead, a Decoder may declare a nested type Workspace and implement
+ *     - double decode(Chromosome& chromosome, Workspace& workspace) const, or
+ *     - double decode(const Chromosome& chromosome, Workspace& workspace) const,
+ * (and, if it implements decodeBatch(), the bounded decode(), estimate() or decodeDelta(), take a
+ * Workspace& as its last argument; see BatchDecoder.h, BoundedDecoder.h, EstimatingDecoder.h and
+ * DeltaDecoder.h). BRKGA then creates one Workspace per population and thread when it is built,
+ * and always passes the workspace of the calling thread, which is never used by two threads at
+ * once. Workspaces are reused for the lifetime of BRKGA, so buffers kept in them and sized on the
+ * first call (e.g., with std::vector::resize()) need no further allocations. Workspace must be
+ * default constructible; it is constructed after the Decoder.
+ *
+ * WorkspaceTraits< Decoder > gives the type used (NoWorkspace for decoders without a Workspace) and
+ * calls the right decode() either way. The choice is made at compile time.
+ *
+ * Authors    : Rodrigo Franco Toso <rtoso@cs.rutgers.edu>
+ *              Mauricio G.C. Resende <mgcr@research.att.com>
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018
+ * Rodrigo Franco Toso (rfrancotoso@gmail.com) and
+ * Mauricio G.C. Resende
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+/**
+ * HasWorkspace< Decoder >::value is true iff Decoder declares a nested type Workspace:
+ */
+template< class Decoder >
+class HasWorkspace {
+	template< class T >
+	static char test(typename T::Workspace*);
+
+	template< class T >
+	static long test(...);
+
+public:
+	enum { value = (sizeof(test< Decoder >(0)) == sizeof(char)) };
+};
+
+/**
+ * Workspace of decoders that do not declare one:
+ */
+struct NoWorkspace {
+};
+
+template< class Decoder, bool workspace = HasWorkspace< Decoder >::value >
+struct WorkspaceTraits {
+	typedef NoWorkspace Workspace;
+
+	template< class Chromosome >
+	static double decode(const Decoder& decoder, Chromosome& chromosome, Workspace&) {
+		return decoder.decode(chromosome);
+	}
+
+	template< class Chromosome >
+	static double decodeBounded(const Decoder& decoder, Chromosome& chromosome, double cutoff,
+			Workspace&) {
+		return decoder.decode(chromosome, cutoff);
+	}
+
+	template< class Chromosome >
+	static double estimate(const Decoder& decoder, Chromosome& chromosome, Workspace&) {
+		return decoder.estimate(chromosome);
+	}
+
+	template< class Chromosome, class State >
+	static double decodeDelta(const Decoder& decoder, Chromosome& chromosome, const State* parent,
+			const unsigned* genes, unsigned count, State& state, Workspace&) {
+		return decoder.decodeDelta(chromosome, parent, genes, count, state);
+	}
+
+	template< class Chromosome >
+	static void decodeBatch(const Decoder& decoder, Chromosome* chromosomes, unsigned n,
+			double* fitness, Workspace&) {
+		decoder.decodeBatch(chromosomes, n, fitness);
+	}
+};
+
+template< class Decoder >
+struct WorkspaceTraits< Decoder, true > {
+	typedef typename Decoder::Workspace Workspace;
+
+	template< class Chromosome >
+	static double decode(const Decoder& decoder, Chromosome& chromosome, Workspace& workspace) {
+		return decoder.decode(chromosome, workspace);
+	}
+
+	template< class Chromosome >
+	static double decodeBounded(const Decoder& decoder, Chromosome& chromosome, double cutoff,
+			Workspace& workspace) {
+		return decoder.decode(chromosome, cutoff, workspace);
+	}
+
+	template< class Chromosome >
+	static double estimate(const Decoder& decoder, Chromosome& chromosome, Workspace& workspace) {
+		return decoder.estimate(chromosome, workspace);
+	}
+
+	template< class Chromosome, class State >
+	static double decodeDelta(const Decoder& decoder, Chromosome& chromosome, const State* parent,
+			const unsigned* genes, unsigned count, State& state, Workspace& workspace) {
+		return decoder.decodeDelta(chromosome, parent, genes, count, state, workspace);
+	}
+
+	template< class Chromosome >
+	static void decodeBatch(const Decoder& decoder, Chromosome* chromosomes, unsigned n,
+			double* fitness, Workspace& workspace) {
+		decoder.decodeBatch(chromosomes, n, fitness, workspace);
+	}
+};
+
+#endif